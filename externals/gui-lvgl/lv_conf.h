@@ -266,7 +266,7 @@ typedef void * lv_img_decoder_user_data_t;
 #define LV_ATTRIBUTE_TASK_HANDLER IRAM_ATTR
 
 /* Define a custom attribute to `lv_disp_flush_ready` function */
-#define LV_ATTRIBUTE_FLUSH_READY
+#define LV_ATTRIBUTE_FLUSH_READY IRAM_ATTR
 
 /* Required alignment size for buffers */
 #define LV_ATTRIBUTE_MEM_ALIGN_SIZE
@@ -0,0 +1,122 @@
+/****************************************************************************************
+ * bench_bus_scheduler.cpp - Host benchmark of the DHT12 acquisition, bus scheduler and sample log
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <stdlib.h>
+#include <unistd.h>
+#include "model/BusScheduler.h"
+#include "model/DHT12Sensor.h"
+#include "model/SampleLog.h"
+#include "HostBench.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+using Clock = ISensor::Clock;
+
+static constexpr size_t Sessions = 200000;
+
+// A DHT12 that answers every transfer at once, so only the CPU time of the model is timed
+class InstantBus : public II2CBus
+{
+    public:
+        Result write(uint8_t address, const uint8_t* data, size_t length, milliseconds timeout) override
+        {
+            return Result::Ok;
+        }
+
+        Result read(uint8_t address, uint8_t* data, size_t length, milliseconds timeout) override
+        {
+            // 45.0 %RH, 22.5 degC and the checksum
+            const uint8_t reading[5] = { 45, 0, 22, 5, 72 };
+            std::copy(reading, reading + std::min(length, sizeof(reading)), data);
+            return Result::Ok;
+        }
+
+        void report_data_error() override
+        {
+        }
+};
+
+// The sessions of a scheduler with a number of DHT12s, each run() is one wakeup of PollSensorTask
+template<size_t Count>
+static void time_sessions(HostBench& bench, const std::string& name)
+{
+    InstantBus bus;
+    std::vector<std::unique_ptr<DHT12Sensor>> sensors;
+    BusScheduler<4> scheduler(seconds(5));
+
+    for (size_t i = 0; i < Count; i++)
+    {
+        sensors.push_back(std::make_unique<DHT12Sensor>(bus, static_cast<uint8_t>(0x5C + i)));
+        sensors.back()->set_period(seconds(30));
+        scheduler.add_sensor(*sensors.back());
+    }
+
+    auto now = Clock::time_point{} + hours(1);
+    uint32_t readings = 0;
+
+    bench.time(name, Sessions, [&](size_t)
+    {
+        scheduler.run(now, [&readings](size_t, ISensor&, const MultiChannelSample&) { readings++; });
+        now = scheduler.get_next_run_time(now);
+    });
+
+    keep(readings);
+}
+
+int main(int argc, char** argv)
+{
+    HostBench bench("bus_scheduler", argc, argv);
+
+    // the two polls of one measurement
+    InstantBus bus;
+    DHT12Acquisition acquisition(bus, DHT12Acquisition::Config{});
+    auto now = Clock::time_point{} + hours(1);
+
+    bench.time("dht12_measurement", 1000000, [&](size_t)
+    {
+        float temperature;
+        float humidity;
+        acquisition.start();
+        acquisition.poll(now, temperature, humidity);
+        keep(acquisition.poll(now, temperature, humidity));
+        keep(temperature);
+    });
+
+    time_sessions<1>(bench, "session_1_sensor");
+    time_sessions<4>(bench, "session_4_sensors");
+
+    // appending records to the log, a sector is written every RecordsPerSector records
+    char path[] = "/tmp/bench_sample_log_XXXXXX";
+
+    if (mkdtemp(path) != nullptr)
+    {
+        std::string directory = path;
+
+        {
+            SampleLog log(directory, 64 * SampleLog::SectorSize);
+            log.open();
+
+            bench.time("sample_log_append", 100000, [&](size_t i)
+            {
+                log.append(static_cast<uint32_t>(i * 30), PackedSample{ 225, 450 });
+            });
+
+            bench.add("sample_log_max_write_stall", log.get_max_write_stall_us(), "us");
+        }
+
+        unlink((directory + "/samples0.log").c_str());
+        unlink((directory + "/samples1.log").c_str());
+        rmdir(directory.c_str());
+    }
+
+    return bench.report();
+}
@@ -0,0 +1,78 @@
+/****************************************************************************************
+ * bench_display_driver.cpp - Host benchmark of the LittlevGL display driver callbacks
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <lvgl/lvgl.h>
+#include "gui/DisplayDriver.h"
+#include "BranchingSetPx.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Pixels = LV_HOR_RES_MAX * LV_VER_RES_MAX;
+static constexpr size_t Areas = 4096;
+
+// The callbacks are called the way LittlevGL calls them, through the registered driver
+int main(int argc, char** argv)
+{
+    HostBench bench("display_driver", argc, argv);
+
+    DisplayDriver display_driver;
+    display_driver.initialize();
+    lv_disp_drv_t* drv = &lv_disp_get_default()->driver;
+
+    // a full buffer of pixels in drawing order, a row of the area at a time, the colour changes
+    // every pixel so neither value of the colour bit can be predicted
+    std::array<uint8_t, LV_HOR_RES_MAX * LV_VER_RES_MAX / 8> buffer{};
+    lv_color_t colors[2];
+    colors[0].full = 0;
+    colors[1].full = 1;
+
+    auto time_set_px = [&](const char* name, decltype(drv->set_px_cb) set_px)
+    {
+        bench.time(name, Pixels, [&](size_t i)
+        {
+            auto x = static_cast<lv_coord_t>(i % LV_HOR_RES_MAX);
+            auto y = static_cast<lv_coord_t>(i / LV_HOR_RES_MAX);
+            set_px(drv, buffer.data(), LV_HOR_RES_MAX, x, y, colors[(i ^ (i >> 7)) & 1], LV_OPA_COVER);
+        });
+
+        keep(buffer);
+    };
+
+    // the registered callback against the one it replaced
+    time_set_px("set_px_cb", drv->set_px_cb);
+    time_set_px("set_px_cb_branching", branching_set_px_cb);
+
+    // invalid areas of every width at every position, as label and chart redraws make them
+    std::array<lv_area_t, Areas> areas{};
+
+    for (size_t i = 0; i < Areas; i++)
+    {
+        auto x1 = static_cast<lv_coord_t>(i % LV_HOR_RES_MAX);
+        auto width = static_cast<lv_coord_t>((i * 7) % 40);
+        areas[i] = lv_area_t{ x1, static_cast<lv_coord_t>(i % LV_VER_RES_MAX),
+                              static_cast<lv_coord_t>(std::min(x1 + width, LV_HOR_RES_MAX - 1)),
+                              LV_VER_RES_MAX - 1 };
+    }
+
+    bench.time("rounder_cb", Areas, [&](size_t i)
+    {
+        lv_area_t area = areas[i];
+        drv->rounder_cb(drv, &area);
+        keep(area);
+    });
+
+    return bench.report();
+}
@@ -0,0 +1,98 @@
+/****************************************************************************************
+ * bench_envir_lookup_table.cpp - The lookup tables against the formulas they replace
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "model/EnvirFormulas.h"
+#include "model/EnvirLookupTable.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Samples = 100000;
+
+// The table ENVIR_VALUE_USE_LOOKUP_TABLE selects, and a finer one
+using DefaultTable = EnvirLookupTable<0, 60, 10, 20>;
+using FineTable = EnvirLookupTable<0, 60, 5, 10>;
+
+static float to_fahrenheit(float temp_deg_c)
+{
+    return ((temp_deg_c * 9.0f) / 5.0f) + 32.0f;
+}
+
+// The largest differences from the formulas over 0 to 60 degC and 0 to 100 %RH by 0.1
+template<typename Table>
+static void add_errors(HostBench& bench, const std::string& name)
+{
+    double heat_index_error = 0;
+    double dew_point_error = 0;
+
+    for (int t = 0; t <= 600; t++)
+    {
+        for (int h = 0; h <= 1000; h++)
+        {
+            float temp_deg_c = t * 0.1f;
+            float humidity = h * 0.1f;
+            float heat_index = EnvirFormulas::heat_index_fahrenheit(to_fahrenheit(temp_deg_c), humidity);
+            float dew_point = EnvirFormulas::dew_point_celsius(temp_deg_c, humidity);
+
+            heat_index_error = std::max(heat_index_error,
+                                        std::fabs(static_cast<double>(Table::heat_index_fahrenheit(temp_deg_c, humidity) - heat_index)));
+            dew_point_error = std::max(dew_point_error,
+                                       std::fabs(static_cast<double>(Table::dew_point_celsius(temp_deg_c, humidity) - dew_point)));
+        }
+    }
+
+    bench.add(name + "_flash_bytes", Table::FlashBytes, "bytes");
+    bench.add(name + "_heat_index_max_error", heat_index_error, "degF");
+    bench.add(name + "_dew_point_max_error", dew_point_error, "degC");
+}
+
+int main(int argc, char** argv)
+{
+    HostBench bench("envir_lookup_table", argc, argv);
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> temperature(0.0f, 60.0f);
+    std::uniform_real_distribution<float> humidity(0.0f, 100.0f);
+    std::vector<float> temps(Samples);
+    std::vector<float> humidities(Samples);
+
+    for (size_t i = 0; i < Samples; i++)
+    {
+        temps[i] = temperature(random);
+        humidities[i] = humidity(random);
+    }
+
+    bench.time("formula_heat_index", Samples, [&](size_t i)
+    {
+        keep(EnvirFormulas::heat_index_fahrenheit(to_fahrenheit(temps[i]), humidities[i]));
+    });
+
+    bench.time("table_heat_index", Samples, [&](size_t i)
+    {
+        keep(DefaultTable::heat_index_fahrenheit(temps[i], humidities[i]));
+    });
+
+    bench.time("formula_dew_point", Samples, [&](size_t i)
+    {
+        keep(EnvirFormulas::dew_point_celsius(temps[i], humidities[i]));
+    });
+
+    bench.time("table_dew_point", Samples, [&](size_t i)
+    {
+        keep(DefaultTable::dew_point_celsius(temps[i], humidities[i]));
+    });
+
+    add_errors<DefaultTable>(bench, "default_table");
+    add_errors<FineTable>(bench, "fine_table");
+
+    return bench.report();
+}
@@ -0,0 +1,75 @@
+/****************************************************************************************
+ * bench_envir_value.cpp - The cost of the EnvirValue getters
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <random>
+#include <vector>
+#include "model/EnvirFormulas.h"
+#include "model/EnvirValue.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Samples = 100000;
+
+// The six getters the views call to show one reading
+static float read_all(const EnvirValue& value)
+{
+    return value.get_temperture_degree_F() + value.get_relative_humidity() + value.get_heat_index_fahrenheit()
+           + value.get_heat_index_celsius() + value.get_dew_point_celsius() + value.get_dew_point_fahrenheit();
+}
+
+// The same six values calculated on every call, as the getters did before they were memoized
+static float read_all_uncached(float temp_deg_c, float humidity)
+{
+    float temp_deg_f = ((temp_deg_c * 9.0f) / 5.0f) + 32.0f;
+    float heat_index_f = EnvirFormulas::heat_index_fahrenheit(((temp_deg_c * 9.0f) / 5.0f) + 32.0f, humidity);
+    float heat_index_c = (EnvirFormulas::heat_index_fahrenheit(temp_deg_f, humidity) - 32.0f) * 0.55555f;
+    float dew_point_c = EnvirFormulas::dew_point_celsius(temp_deg_c, humidity);
+    float dew_point_f = EnvirFormulas::dew_point_celsius(temp_deg_c, humidity) * 1.8f + 32.0f;
+
+    return temp_deg_f + humidity + heat_index_f + heat_index_c + dew_point_c + dew_point_f;
+}
+
+int main(int argc, char** argv)
+{
+    HostBench bench("envir_value", argc, argv);
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> temperature(0.0f, 60.0f);
+    std::uniform_real_distribution<float> humidity(0.0f, 100.0f);
+    std::vector<EnvirValue> values(Samples);
+
+    for (auto& value : values)
+    {
+        value.set_temperture_degree_C(temperature(random));
+        value.set_relative_humidity(humidity(random));
+    }
+
+    // a new reading, the first getter calculates the derived values for all six
+    std::vector<EnvirValue> fresh(values);
+    bench.time("six_getters_new_reading", Samples, [&](size_t i)
+    {
+        fresh[i] = values[i];
+        keep(read_all(fresh[i]));
+    });
+
+    // the same reading shown again, every getter is a load
+    bench.time("six_getters_cached", Samples, [&](size_t i)
+    {
+        keep(read_all(fresh[i]));
+    });
+
+    bench.time("six_getters_uncached", Samples, [&](size_t i)
+    {
+        keep(read_all_uncached(values[i].get_temperature_degree_C(), values[i].get_relative_humidity()));
+    });
+
+    bench.add("envir_value_bytes", sizeof(EnvirValue), "bytes");
+
+    return bench.report();
+}
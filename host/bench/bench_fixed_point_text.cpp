@@ -0,0 +1,66 @@
+/****************************************************************************************
+ * bench_fixed_point_text.cpp - The cost of formatting a readout value
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cstdio>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "gui/FixedPointText.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Values = 200000;
+
+int main(int argc, char** argv)
+{
+    HostBench bench("fixed_point_text", argc, argv);
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> range(-40.0f, 140.0f);
+    std::vector<float> values(Values);
+
+    for (auto& value : values)
+    {
+        value = range(random);
+    }
+
+    // what the content panes do for each new value
+    bench.time("fixed_point_text", Values, [&](size_t i)
+    {
+        FixedPointText<16> text{};
+        keep(text.format(values[i], 1, "°F"));
+    });
+
+    // the ostringstream the panes used before, reused so only the formatting is timed
+    std::ostringstream stream;
+
+    bench.time("ostringstream_reused", Values, [&](size_t i)
+    {
+        stream.str("");
+        stream << std::fixed << std::setprecision(1) << values[i] << "°F";
+        keep(stream.str());
+    });
+
+    bench.time("ostringstream_new", Values, [&](size_t i)
+    {
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(1) << values[i] << "°F";
+        keep(s.str());
+    });
+
+    bench.time("snprintf", Values, [&](size_t i)
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%.1f°F", static_cast<double>(values[i]));
+        keep(text[0]);
+    });
+
+    return bench.report();
+}
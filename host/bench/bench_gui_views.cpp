@@ -0,0 +1,160 @@
+/****************************************************************************************
+ * bench_gui_views.cpp - Host benchmark of the view frames and the button read path
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <chrono>
+#include <string>
+#include <thread>
+#include <driver/gpio.h>
+#include <esp_timer.h>
+#include <lvgl/lvgl.h>
+#include <smooth/core/ipc/Publisher.h>
+#include <smooth/core/timer/Timer.h>
+#include "gui/LvglTask.h"
+#include "gui/MenuPane.h"
+#include "BranchingSetPx.h"
+#include "HostBench.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+using namespace smooth::core::ipc;
+using namespace smooth::core::timer;
+
+static constexpr size_t Frames = 500;
+static constexpr size_t Reads = 100000;
+static const char* ViewNames[] = { "temperature", "humidity", "heat_index", "dew_point", "trend" };
+
+// Run the timers and the events of the task in real time, LittlevGL reads esp_timer
+static void run_for(LvglTask& task, milliseconds duration)
+{
+    auto end = steady_clock::now() + duration;
+
+    while (steady_clock::now() < end)
+    {
+        Timer::host_expire(steady_clock::now());
+        task.host_run_events();
+        std::this_thread::sleep_for(milliseconds(2));
+    }
+}
+
+// Have the refresh task of LittlevGL run on the next lv_task_handler()
+static void run_refresh()
+{
+    lv_task_ready(lv_disp_get_default()->refr_task);
+    lv_task_handler();
+}
+
+// Each view is shown with the button, as on the device, and its frames are timed through
+// lv_task_handler().  The SPI stand-in sends at once, so a frame is the render and flush CPU
+// time of LvglTask.
+int main(int argc, char** argv)
+{
+    HostBench bench("gui_views", argc, argv);
+
+    // the button has an external pull-up, it is released
+    gpio_host_drive_input(GPIO_NUM_35, 1);
+
+    LvglTask task;
+    task.start();
+    run_for(task, milliseconds(200));
+
+    for (int view = 0; view < ViewController::ViewCount; view++)
+    {
+        std::string name = std::string("view_") + ViewNames[view];
+
+        // the whole screen redrawn, as after a view switch
+        bench.time(name + "_full_frame", Frames, [&](size_t)
+        {
+            lv_obj_invalidate(lv_scr_act());
+            run_refresh();
+        });
+
+        // a new value, or a new trend point on the trend view, redrawn where it changed
+        uint32_t redraws = task.get_view_controller().get_label_redraw_count()
+                           + task.get_view_controller().get_trend_point_count();
+
+        bench.time(name + "_update_frame", Frames, [&](size_t i)
+        {
+            if (view == ViewController::Trend)
+            {
+                auto time_s = static_cast<uint32_t>(30 * (i + 1));
+                Publisher<SampleLog::Record>::publish(SampleLog::Record{ time_s, PackedSample::pack(22.0f + (i & 7) * 0.2f, 45.0f) });
+            }
+            else
+            {
+                EnvirValue value{};
+                value.set_temperture_degree_C(i & 1 ? 22.5f : 23.0f);
+                value.set_relative_humidity(i & 1 ? 45.0f : 46.0f);
+                Publisher<EnvirValue>::publish(value);
+            }
+
+            task.host_run_events();
+            run_refresh();
+        });
+
+        bench.add(name + "_redraws_per_update",
+                  static_cast<double>(task.get_view_controller().get_label_redraw_count()
+                                      + task.get_view_controller().get_trend_point_count() - redraws)
+                  / (HostBench::Runs * Frames), "redraws");
+
+        // on to the next view
+        gpio_host_drive_input(GPIO_NUM_35, 0);
+        run_for(task, milliseconds(100));
+        gpio_host_drive_input(GPIO_NUM_35, 1);
+        run_for(task, milliseconds(200));
+    }
+
+    // A full frame of the temperature view rendered and flushed by lv_refr_now(), with the
+    // branch-free set_px_cb and with the one it replaced
+    lv_disp_drv_t* drv = &lv_disp_get_default()->driver;
+    auto set_px = drv->set_px_cb;
+
+    for (auto callback : { set_px, &branching_set_px_cb })
+    {
+        drv->set_px_cb = callback;
+        const char* name = callback == set_px ? "refr_now_full_frame" : "refr_now_full_frame_branching_set_px";
+
+        bench.time(name, Frames, [&](size_t)
+        {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(nullptr);
+        });
+    }
+
+    drv->set_px_cb = set_px;
+
+    // The input driver of the menu pane, found the way LittlevGL's read task calls it.  Without
+    // edges the read returns the current state, with a buffered edge it takes the edge out of
+    // the ring and times the press until it is redrawn.
+    lv_indev_t* indev = lv_indev_get_next(nullptr);
+    auto* menu_pane = static_cast<MenuPane*>(indev->driver.user_data);
+    lv_indev_data_t data{};
+
+    bench.time("menu_pane_read_idle", Reads, [&](size_t)
+    {
+        indev->driver.read_cb(&indev->driver, &data);
+        keep(data);
+    });
+
+    bench.time("menu_pane_edge_and_read", Reads, [&](size_t i)
+    {
+        menu_pane->event(HwButtonEdge(MenuPane::Button35, (i & 1) == 0, esp_timer_get_time()));
+        indev->driver.read_cb(&indev->driver, &data);
+        keep(data);
+    });
+
+    return bench.report();
+}
@@ -0,0 +1,97 @@
+/****************************************************************************************
+ * bench_readout.cpp - Host benchmark of a value update drawn by an lv_label and by a GuiReadout
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <lvgl/lvgl.h>
+#include "gui/DisplayDriver.h"
+#include "gui/GuiReadout.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Updates = 20000;
+static const char* Values[] = { "72.5°F", "73.0°F" };
+
+// A content pane container as the CP panes create it, 128 x 22 with a black background
+static lv_obj_t* create_container(lv_style_t& style)
+{
+    lv_style_init(&style);
+    lv_style_set_border_width(&style, LV_STATE_DEFAULT, 0);
+    lv_style_set_radius(&style, LV_STATE_DEFAULT, 0);
+    lv_style_set_bg_color(&style, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+
+    lv_obj_t* container = lv_cont_create(lv_scr_act(), NULL);
+    lv_obj_set_size(container, LV_HOR_RES, 22);
+    lv_cont_set_layout(container, LV_LAYOUT_OFF);
+    lv_obj_align(container, NULL, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_add_style(container, LV_CONT_PART_MAIN, &style);
+
+    return container;
+}
+
+// The time of one value change until it is flushed, the way the content panes drew the value
+// before and after the readout glyph atlas.  The SPI stand-in sends at once, so both include
+// the same flush and differ in the drawing.
+int main(int argc, char** argv)
+{
+    HostBench bench("readout", argc, argv);
+
+    DisplayDriver display_driver;
+    display_driver.initialize();
+
+    lv_style_t container_style;
+    lv_style_t label_style;
+    lv_obj_t* container = create_container(container_style);
+
+    lv_style_init(&label_style);
+    lv_style_set_text_color(&label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_style_set_text_font(&label_style, LV_STATE_DEFAULT, &lv_font_14x14B_latin1_sup);
+
+    lv_obj_t* label = lv_label_create(container, NULL);
+    lv_obj_add_style(label, LV_LABEL_PART_MAIN, &label_style);
+    lv_refr_now(NULL);
+
+    uint32_t transactions = display_driver.get_spi_transaction_count();
+
+    bench.time("label_update", Updates, [&](size_t i)
+    {
+        lv_label_set_text_static(label, Values[i & 1]);
+        lv_obj_align(label, NULL, LV_ALIGN_CENTER, 5, 0);
+        lv_refr_now(NULL);
+    });
+
+    bench.add("label_transactions_per_update",
+              static_cast<double>(display_driver.get_spi_transaction_count() - transactions) / (HostBench::Runs * Updates),
+              "transactions");
+
+    lv_obj_del(container);
+    container = create_container(container_style);
+
+    GuiReadout readout;
+    readout.create(container);
+    lv_obj_align(readout.get_obj(), NULL, LV_ALIGN_CENTER, 0, 0);
+    lv_refr_now(NULL);
+
+    transactions = display_driver.get_spi_transaction_count();
+
+    bench.time("readout_update", Updates, [&](size_t i)
+    {
+        readout.set_text(Values[i & 1]);
+        lv_refr_now(NULL);
+    });
+
+    bench.add("readout_transactions_per_update",
+              static_cast<double>(display_driver.get_spi_transaction_count() - transactions) / (HostBench::Runs * Updates),
+              "transactions");
+
+    return bench.report();
+}
@@ -0,0 +1,117 @@
+/****************************************************************************************
+ * bench_rolling_stats.cpp - The cost per sample of the rolling windows
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+#include "model/EnvirStats.h"
+#include "model/RollingStats.h"
+#include "HostBench.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Samples = 200000;
+
+// Min, max and sum found by looking at every sample of the window, what the rolling windows replace
+template<size_t Length>
+class ScanWindow
+{
+    public:
+        void add(int16_t value)
+        {
+            values.push_back(value);
+
+            if (values.size() > Length)
+            {
+                values.pop_front();
+            }
+        }
+
+        RollingResult get() const
+        {
+            RollingResult result{ values.front(), values.front(), 0, static_cast<uint32_t>(values.size()) };
+
+            for (auto value : values)
+            {
+                result.min = value < result.min ? value : result.min;
+                result.max = value > result.max ? value : result.max;
+                result.sum += value;
+            }
+
+            return result;
+        }
+
+    private:
+        std::deque<int16_t> values{};
+};
+
+// The add and get of every recorded sample, over a window of a given length
+template<typename Window>
+static void time_window(HostBench& bench, const std::string& name, const std::vector<int16_t>& input)
+{
+    auto window = std::make_unique<Window>();
+
+    bench.time(name, input.size(), [&](size_t i)
+    {
+        window->add(input[i]);
+        keep(window->get());
+    });
+}
+
+int main(int argc, char** argv)
+{
+    HostBench bench("rolling_stats", argc, argv);
+
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> step(-3, 3);
+    std::vector<int16_t> input(Samples);
+    int16_t value = 215;
+
+    for (auto& sample : input)
+    {
+        value = static_cast<int16_t>(value + step(random));
+        sample = value;
+    }
+
+    // the cost does not grow with the window length
+    time_window<RollingWindow<120, 1>>(bench, "rolling_1h_120x1", input);
+    time_window<RollingWindow<288, 10>>(bench, "rolling_24h_288x10", input);
+    time_window<RollingWindow<2880, 1>>(bench, "rolling_24h_2880x1", input);
+
+    // a scan grows with it
+    time_window<ScanWindow<120>>(bench, "scan_1h_120", input);
+    time_window<ScanWindow<2880>>(bench, "scan_24h_2880", input);
+
+    // the four windows and the EnvirStats update of one recorded sample, as in PollSensorTask
+    struct Windows
+    {
+        RollingWindow<120, 1> temperature_hour;
+        RollingWindow<120, 1> humidity_hour;
+        RollingWindow<288, 10> temperature_day;
+        RollingWindow<288, 10> humidity_day;
+    };
+
+    auto windows = std::make_unique<Windows>();
+    EnvirStats stats{};
+
+    bench.time("record_sample_stats", input.size(), [&](size_t i)
+    {
+        windows->temperature_hour.add(input[i]);
+        windows->humidity_hour.add(input[i]);
+        windows->temperature_day.add(input[i]);
+        windows->humidity_day.add(input[i]);
+        stats.set(EnvirStats::OneHour, windows->temperature_hour.get(), windows->humidity_hour.get());
+        stats.set(EnvirStats::OneDay, windows->temperature_day.get(), windows->humidity_day.get());
+        keep(stats);
+    });
+
+    bench.add("rolling_windows_bytes", sizeof(Windows), "bytes");
+
+    return bench.report();
+}
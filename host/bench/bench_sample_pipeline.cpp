@@ -0,0 +1,83 @@
+/****************************************************************************************
+ * bench_sample_pipeline.cpp - Host benchmark of the sample filter, poll policy and sample history
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <memory>
+#include <random>
+#include <vector>
+#include "model/AdaptivePollPolicy.h"
+#include "model/SampleFilter.h"
+#include "model/SampleHistory.h"
+#include "HostBench.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr size_t Readings = 300000;
+
+int main(int argc, char** argv)
+{
+    HostBench bench("sample_pipeline", argc, argv);
+
+    // raw DHT12 readings around 22.5 degC and 45 %RH with +-0.2 of noise
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> noise(-2, 2);
+    std::vector<PackedSample> raw(Readings);
+
+    for (auto& sample : raw)
+    {
+        sample = PackedSample{ static_cast<int16_t>(225 + noise(random)), static_cast<uint16_t>(450 + noise(random)) };
+    }
+
+    // the burst of 3 readings and its decimation, as in DHT12Sensor
+    SampleFilter<3, 2> filter{};
+    std::vector<PackedSample> filtered(Readings / 3);
+
+    bench.time("filter_burst_of_3", filtered.size(), [&](size_t i)
+    {
+        filter.add(raw[i * 3]);
+        filter.add(raw[i * 3 + 1]);
+        filter.add(raw[i * 3 + 2]);
+        filtered[i] = filter.decimate();
+    });
+
+    // the interval and publish decision of one filtered reading, as in PollSensorTask
+    AdaptivePollPolicy policy(AdaptivePollPolicy::Config{});
+    auto now = AdaptivePollPolicy::Clock::time_point{} + hours(1);
+
+    bench.time("poll_policy_reading", filtered.size(), [&](size_t i)
+    {
+        now += policy.next_interval(now, filter.get_last_median());
+        keep(policy.should_publish(filtered[i]));
+    });
+
+    // the 24 h history of 30 sec samples PollSensorTask keeps
+    auto history = std::make_unique<SampleHistory<24 * 60 * 2>>();
+
+    bench.time("history_append", filtered.size(), [&](size_t i)
+    {
+        history->append(filtered[i]);
+    });
+
+    bench.time("history_walk_24h", 200, [&](size_t)
+    {
+        int32_t sum = 0;
+
+        for (const auto& sample : *history)
+        {
+            sum += sample.temperature_deci_c;
+        }
+
+        keep(sum);
+    });
+
+    bench.add("filter_bytes", sizeof(SampleFilter<3, 2>), "bytes");
+    bench.add("poll_policy_bytes", sizeof(AdaptivePollPolicy), "bytes");
+    bench.add("history_24h_bytes", sizeof(SampleHistory<24 * 60 * 2>), "bytes");
+
+    return bench.report();
+}
@@ -0,0 +1,182 @@
+/****************************************************************************************
+ * bench_sh1107_flush.cpp - Host benchmark of the SH1107 shadow frame buffer and page flush
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "gui/SH1107FrameBuffer.h"
+#include "gui/SH1107PageFlush.h"
+#include "gui/SH1107Spi.h"
+#include "stats/TimingStats.h"
+#include "HostBench.h"
+#include "SH1107Sim.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr int Columns = SH1107FrameBuffer::Columns;
+static constexpr int Pages = SH1107FrameBuffer::Pages;
+static constexpr size_t Flushes = 20000;
+
+using Screen = std::array<uint8_t, Columns * Pages>;
+using SteadyClock = std::chrono::steady_clock;
+
+// Keeps the time each transaction goes out.  The SPI stand-in sends a transaction the moment
+// it is queued, so the time between two transactions of a flush is the CPU time the flush
+// spends between queueing them, the bus gap an infinitely fast bus would see.  A flush
+// alternates command and data transactions, the gap before a command is between two pages.
+struct GapSink
+{
+    std::vector<SteadyClock::time_point> sent{};
+    std::vector<double> page_gaps_ns{};
+    std::vector<double> command_data_gaps_ns{};
+
+    static void receive(void* context, const uint8_t*, size_t)
+    {
+        static_cast<GapSink*>(context)->sent.push_back(SteadyClock::now());
+    }
+
+    // Keep the gaps of one flush and start the next
+    void end_flush()
+    {
+        for (size_t i = 1; i < sent.size(); i++)
+        {
+            double gap = std::chrono::duration<double, std::nano>(sent[i] - sent[i - 1]).count();
+            (i % 2 == 0 ? page_gaps_ns : command_data_gaps_ns).push_back(gap);
+        }
+
+        sent.clear();
+    }
+
+    void add_results(HostBench& bench, const std::string& name)
+    {
+        add_percentiles(bench, name + "_between_pages", page_gaps_ns);
+        add_percentiles(bench, name + "_command_to_data", command_data_gaps_ns);
+    }
+
+    static void add_percentiles(HostBench& bench, const std::string& name, std::vector<double>& gaps)
+    {
+        std::sort(gaps.begin(), gaps.end());
+        bench.add(name + "_p50", gaps[gaps.size() / 2], "ns", gaps.size());
+        bench.add(name + "_p99", gaps[gaps.size() * 99 / 100], "ns", gaps.size());
+        gaps.clear();
+    }
+};
+
+int main(int argc, char** argv)
+{
+    HostBench bench("sh1107_flush", argc, argv);
+
+    // the compare of a page against the shadow frame buffer, clean and with one changed column
+    SH1107FrameBuffer frame_buffer{};
+    std::array<uint8_t, Columns> page{};
+
+    bench.time("update_page_clean", 1000000, [&](size_t)
+    {
+        int first_dirty;
+        size_t length;
+        keep(frame_buffer.update_page(5, 0, Columns - 1, page.data(), first_dirty, length));
+    });
+
+    bench.time("update_page_one_column", 1000000, [&](size_t i)
+    {
+        int first_dirty;
+        size_t length;
+        page[20] = static_cast<uint8_t>(i);
+        keep(frame_buffer.update_page(5, 0, Columns - 1, page.data(), first_dirty, length));
+    });
+
+    // whole flushes through SH1107Spi into the simulated display, the SPI stand-in sends
+    // right away so this is the CPU time of preparing and queueing the transactions
+    SH1107Spi spi(GPIO_NUM_14, GPIO_NUM_27, GPIO_NUM_33, SPI_MASTER_FREQ_8M);
+    SH1107Sim display(GPIO_NUM_27);
+    display.attach(VSPI_HOST);
+    spi.initialize(VSPI_HOST);
+
+    std::array<uint8_t, SH1107PageFlush<SH1107Spi>::CmdBufferLen> page_commands{};
+    SH1107PageFlush<SH1107Spi> page_flush(spi, page_commands.data());
+    auto screen = std::make_unique<Screen>();
+    page_flush.prepare_clear(screen->data());
+    spi.submit(false);
+    spi.collect_results();
+
+    auto flush = [&]()
+    {
+        page_flush.prepare_area(0, Pages - 1, 0, Columns - 1, screen->data());
+        spi.submit(true);
+        spi.collect_results();
+    };
+
+    bench.time("flush_unchanged", Flushes, [&](size_t)
+    {
+        flush();
+    });
+
+    // a readout digit of 16 columns on 2 pages changes
+    bench.time("flush_readout_digit", Flushes, [&](size_t i)
+    {
+        for (int p = 2; p < 4; p++)
+        {
+            for (int c = 30; c < 46; c++)
+            {
+                (*screen)[p * Columns + c] = static_cast<uint8_t>(i + c);
+            }
+        }
+
+        flush();
+    });
+
+    // every column of every page changes
+    bench.time("flush_full_screen", Flushes, [&](size_t i)
+    {
+        std::fill(screen->begin(), screen->end(), (i & 1) != 0 ? 0xAA : 0x55);
+        flush();
+    });
+
+    // The gaps between the transactions of a full screen flush.  Batched is the flush as
+    // DisplayDriver does it, every page prepared and then all queued back to back.  Per page
+    // is how it was done before, the compare of the next page runs between two queue calls.
+    GapSink gaps;
+    spi_bus_host_set_sink(VSPI_HOST, GapSink::receive, &gaps);
+    TimingStats::instance().take_summary(TimingStats::SpiBusGap);
+
+    for (size_t i = 0; i < Flushes; i++)
+    {
+        std::fill(screen->begin(), screen->end(), (i & 1) != 0 ? 0xAA : 0x55);
+        flush();
+        gaps.end_flush();
+    }
+
+    gaps.add_results(bench, "bus_gap_batched");
+
+    // the SpiBusGap probe of the pre-transaction callback sees the same gaps, in CPU cycles
+    auto probe = TimingStats::instance().take_summary(TimingStats::SpiBusGap);
+    bench.add("bus_gap_probe_count", probe.count, "gaps");
+
+    for (size_t i = 0; i < Flushes; i++)
+    {
+        std::fill(screen->begin(), screen->end(), (i & 1) != 0 ? 0xAA : 0x55);
+
+        for (int p = 0; p < Pages; p++)
+        {
+            page_flush.prepare_area(p, p, 0, Columns - 1, screen->data() + p * Columns);
+            spi.submit(p == Pages - 1);
+        }
+
+        spi.collect_results();
+        gaps.end_flush();
+    }
+
+    gaps.add_results(bench, "bus_gap_per_page");
+    spi_bus_host_set_sink(VSPI_HOST, nullptr, nullptr);
+
+    bench.add("frame_buffer_bytes", sizeof(SH1107FrameBuffer), "bytes");
+
+    return bench.report();
+}
@@ -0,0 +1,69 @@
+/****************************************************************************************
+ * driver/i2c.h - Host stand-in for the ESP-IDF I2C master driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum { I2C_NUM_0 = 0, I2C_NUM_1 = 1, I2C_NUM_MAX } i2c_port_t;
+typedef enum { I2C_MASTER_WRITE = 0, I2C_MASTER_READ = 1 } i2c_rw_t;
+typedef enum { I2C_MASTER_ACK = 0, I2C_MASTER_NACK = 1, I2C_MASTER_LAST_NACK = 2 } i2c_ack_type_t;
+
+typedef struct i2c_cmd_t* i2c_cmd_handle_t;
+
+// Host only - the device on a port sees each command link as one transfer to or from an
+// address, it fills the buffer of a read and returns the result of the transfer
+typedef esp_err_t (*i2c_host_device_t)(void* context, uint8_t address, i2c_rw_t rw, uint8_t* data, size_t length);
+
+// Host only - the timing last set on a port, in APB clock cycles
+typedef struct
+{
+    int high_period;
+    int low_period;
+    int sda_sample_time;
+    int sda_hold_time;
+    int start_setup_time;
+    int start_hold_time;
+    int stop_setup_time;
+    int stop_hold_time;
+} i2c_host_timing_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+i2c_cmd_handle_t i2c_cmd_link_create(void);
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd_handle, uint8_t data, bool ack_en);
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd_handle, uint8_t* data, size_t data_len, bool ack_en);
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd_handle, uint8_t* data, size_t data_len, i2c_ack_type_t ack);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_cmd_begin(i2c_port_t i2c_num, i2c_cmd_handle_t cmd_handle, TickType_t ticks_to_wait);
+
+esp_err_t i2c_set_period(i2c_port_t i2c_num, int high_period, int low_period);
+esp_err_t i2c_set_data_timing(i2c_port_t i2c_num, int sample_time, int hold_time);
+esp_err_t i2c_set_start_timing(i2c_port_t i2c_num, int setup_time, int hold_time);
+esp_err_t i2c_set_stop_timing(i2c_port_t i2c_num, int setup_time, int hold_time);
+
+/// Host only - set the device that answers the transfers on a port
+/// \param i2c_num The port
+/// \param device The device, nullptr for an empty bus where every transfer is NACKed
+/// \param context The first argument of the device
+void i2c_host_set_device(i2c_port_t i2c_num, i2c_host_device_t device, void* context);
+
+/// Host only - get the timing last set on a port
+/// \param i2c_num The port
+/// \return Returns the periods and the data, start and stop timing
+i2c_host_timing_t i2c_host_get_timing(i2c_port_t i2c_num);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,81 @@
+/****************************************************************************************
+ * driver/spi_master.h - Host stand-in for the ESP-IDF SPI master driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#define SPI_MASTER_FREQ_8M      (80 * 1000 * 1000 / 10)
+#define SPI_MASTER_FREQ_10M     (80 * 1000 * 1000 / 8)
+#define SPI_MASTER_FREQ_20M     (80 * 1000 * 1000 / 4)
+
+typedef enum { SPI1_HOST = 0, HSPI_HOST = 1, VSPI_HOST = 2 } spi_host_device_t;
+
+typedef struct spi_transaction_t spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t* trans);
+
+struct spi_transaction_t
+{
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;
+    size_t rxlength;
+    void* user;
+    const void* tx_buffer;
+    void* rx_buffer;
+};
+
+typedef struct
+{
+    uint8_t command_bits;
+    uint8_t address_bits;
+    uint8_t dummy_bits;
+    uint8_t mode;
+    uint16_t duty_cycle_pos;
+    uint16_t cs_ena_pretrans;
+    uint8_t cs_ena_posttrans;
+    int clock_speed_hz;
+    int input_delay_ns;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+typedef struct spi_device_t* spi_device_handle_t;
+
+// Host only - receives the bytes of each transaction the way a device on the bus sees them,
+// after the pre-transaction callback (e.g. a D/C line) and before the post-transaction callback
+typedef void (*spi_host_sink_t)(void* context, const uint8_t* data, size_t length);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+
+// The host has no DMA, a queued transaction is sent right away and waits for its result
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t ticks_to_wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, TickType_t ticks_to_wait);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans);
+
+/// Host only - set the receiver of the bytes sent on a bus
+/// \param host The bus
+/// \param sink The receiver, nullptr to drop the bytes
+/// \param context The first argument of the receiver
+void spi_bus_host_set_sink(spi_host_device_t host, spi_host_sink_t sink, void* context);
+
+#ifdef __cplusplus
+}
+#endif
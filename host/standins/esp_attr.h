@@ -0,0 +1,14 @@
+/****************************************************************************************
+ * esp_attr.h - Host stand-in for the ESP-IDF placement attributes
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+// Everything runs from the same memory on the host
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
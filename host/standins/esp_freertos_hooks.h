@@ -0,0 +1,14 @@
+/****************************************************************************************
+ * esp_freertos_hooks.h - Host stand-in for the FreeRTOS hooks
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef bool (*esp_freertos_idle_cb_t)(void);
+typedef void (*esp_freertos_tick_cb_t)(void);
@@ -0,0 +1,26 @@
+/****************************************************************************************
+ * esp_timer.h - Host stand-in for the ESP-IDF high resolution timer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Get the time since start up in microseconds, it follows the steady clock unless it is set
+int64_t esp_timer_get_time(void);
+
+/// Host only - hold the time at a value so code that reads esp_timer can be tested step by step
+/// \param time_us The time to report, a negative time follows the steady clock again
+void esp_timer_host_set_time(int64_t time_us);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,28 @@
+/****************************************************************************************
+ * freertos/FreeRTOS.h - Host stand-in for the FreeRTOS types
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define portMAX_DELAY       ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS  ((TickType_t) 1000 / CONFIG_FREERTOS_HZ)
+#define pdMS_TO_TICKS(ms)   ((TickType_t) (((TickType_t) (ms) * CONFIG_FREERTOS_HZ) / 1000))
+#define pdTRUE              1
+#define pdFALSE             0
+#define tskNO_AFFINITY      0x7FFFFFFF
+
+// The host runs everything on core 0
+static inline BaseType_t xPortGetCoreID(void)
+{
+    return 0;
+}
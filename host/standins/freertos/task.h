@@ -0,0 +1,10 @@
+/****************************************************************************************
+ * freertos/task.h - Host stand-in for the FreeRTOS task functions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include "freertos/FreeRTOS.h"
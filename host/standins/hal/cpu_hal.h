@@ -0,0 +1,23 @@
+/****************************************************************************************
+ * hal/cpu_hal.h - Host stand-in for the cycle counter
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The host has no cycle counter, the steady clock is scaled to the ESP32 clock so the cycle
+/// counts of TimingStats and TraceRing read the same as on the device
+uint32_t cpu_hal_get_cycle_count(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,355 @@
+/****************************************************************************************
+ * idf_host.cpp - The host implementation of the ESP-IDF stand-ins
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "hal/cpu_hal.h"
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "driver/spi_master.h"
+
+using namespace std::chrono;
+
+namespace
+{
+    // esp_timer
+    std::atomic<int64_t> fixed_time_us{ -1 };
+    const steady_clock::time_point start_time = steady_clock::now();
+
+    // gpio
+    struct Pin
+    {
+        uint32_t level;
+        bool interrupt_enabled;
+        gpio_int_type_t intr_type;
+        gpio_isr_t isr_handler;
+        void* isr_arg;
+    };
+
+    std::array<Pin, GPIO_NUM_MAX> pins{};
+
+    // spi
+    struct Bus
+    {
+        spi_host_sink_t sink;
+        void* context;
+    };
+
+    std::array<Bus, 3> buses{};
+
+    // i2c
+    struct Port
+    {
+        i2c_host_device_t device;
+        void* context;
+        i2c_host_timing_t timing;
+    };
+
+    std::array<Port, I2C_NUM_MAX> ports{};
+}
+
+struct spi_device_t
+{
+    spi_host_device_t host;
+    spi_device_interface_config_t config;
+    std::deque<spi_transaction_t*> results;
+};
+
+// A command link is one transfer, the first byte written is the address and direction
+struct i2c_cmd_t
+{
+    bool has_address;
+    uint8_t address_byte;
+    uint8_t* data;
+    size_t length;
+};
+
+extern "C" {
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+        case ESP_OK:
+            return "ESP_OK";
+        case ESP_FAIL:
+            return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:
+            return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:
+            return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE:
+            return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_TIMEOUT:
+            return "ESP_ERR_TIMEOUT";
+        default:
+            return "UNKNOWN ERROR";
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    int64_t fixed = fixed_time_us.load();
+    return fixed >= 0 ? fixed : duration_cast<microseconds>(steady_clock::now() - start_time).count();
+}
+
+void esp_timer_host_set_time(int64_t time_us)
+{
+    fixed_time_us = time_us;
+}
+
+uint32_t cpu_hal_get_cycle_count(void)
+{
+    auto ns = duration_cast<nanoseconds>(steady_clock::now() - start_time).count();
+    return static_cast<uint32_t>(ns * CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ / 1000);
+}
+
+esp_err_t gpio_config(const gpio_config_t* config)
+{
+    for (int pin = 0; pin < GPIO_NUM_MAX; pin++)
+    {
+        if (config->pin_bit_mask & (1ULL << pin))
+        {
+            pins[pin].intr_type = config->intr_type;
+            pins[pin].interrupt_enabled = config->intr_type != GPIO_INTR_DISABLE;
+            pins[pin].level = config->pull_up_en == GPIO_PULLUP_ENABLE ? 1 : pins[pin].level;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    pins[gpio_num].level = level ? 1 : 0;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    return static_cast<int>(pins[gpio_num].level);
+}
+
+esp_err_t gpio_install_isr_service(int)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void* args)
+{
+    pins[gpio_num].isr_handler = isr_handler;
+    pins[gpio_num].isr_arg = args;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    pins[gpio_num].isr_handler = nullptr;
+    pins[gpio_num].isr_arg = nullptr;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    pins[gpio_num].interrupt_enabled = pins[gpio_num].intr_type != GPIO_INTR_DISABLE;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    pins[gpio_num].interrupt_enabled = false;
+    return ESP_OK;
+}
+
+void gpio_host_drive_input(gpio_num_t gpio_num, uint32_t level)
+{
+    Pin& pin = pins[gpio_num];
+    level = level ? 1 : 0;
+
+    bool rising = pin.level == 0 && level == 1;
+    bool falling = pin.level == 1 && level == 0;
+    pin.level = level;
+
+    bool fires = (pin.intr_type == GPIO_INTR_ANYEDGE && (rising || falling))
+                 || (pin.intr_type == GPIO_INTR_POSEDGE && rising)
+                 || (pin.intr_type == GPIO_INTR_NEGEDGE && falling);
+
+    if (fires && pin.interrupt_enabled && pin.isr_handler != nullptr)
+    {
+        pin.isr_handler(pin.isr_arg);
+    }
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle)
+{
+    *handle = new spi_device_t{ host, *config, {} };
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle)
+{
+    delete handle;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans)
+{
+    if (handle->config.pre_cb != nullptr)
+    {
+        handle->config.pre_cb(trans);
+    }
+
+    const Bus& bus = buses[handle->host];
+
+    if (bus.sink != nullptr)
+    {
+        bus.sink(bus.context, static_cast<const uint8_t*>(trans->tx_buffer), trans->length / 8);
+    }
+
+    if (handle->config.post_cb != nullptr)
+    {
+        handle->config.post_cb(trans);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t)
+{
+    if (handle->results.size() >= static_cast<size_t>(handle->config.queue_size))
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    spi_device_polling_transmit(handle, trans);
+    handle->results.push_back(trans);
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, TickType_t)
+{
+    if (handle->results.empty())
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    *trans = handle->results.front();
+    handle->results.pop_front();
+
+    return ESP_OK;
+}
+
+void spi_bus_host_set_sink(spi_host_device_t host, spi_host_sink_t sink, void* context)
+{
+    buses[host] = Bus{ sink, context };
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create(void)
+{
+    return new i2c_cmd_t{};
+}
+
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd_handle)
+{
+    delete cmd_handle;
+}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd_handle, uint8_t data, bool)
+{
+    if (!cmd_handle->has_address)
+    {
+        cmd_handle->has_address = true;
+        cmd_handle->address_byte = data;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd_handle, uint8_t* data, size_t data_len, bool)
+{
+    cmd_handle->data = data;
+    cmd_handle->length = data_len;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd_handle, uint8_t* data, size_t data_len, i2c_ack_type_t)
+{
+    cmd_handle->data = data;
+    cmd_handle->length = data_len;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_stop(i2c_cmd_handle_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_cmd_begin(i2c_port_t i2c_num, i2c_cmd_handle_t cmd_handle, TickType_t)
+{
+    const Port& port = ports[i2c_num];
+
+    if (port.device == nullptr)
+    {
+        return ESP_FAIL;
+    }
+
+    auto address = static_cast<uint8_t>(cmd_handle->address_byte >> 1);
+    auto rw = static_cast<i2c_rw_t>(cmd_handle->address_byte & 1);
+    return port.device(port.context, address, rw, cmd_handle->data, cmd_handle->length);
+}
+
+esp_err_t i2c_set_period(i2c_port_t i2c_num, int high_period, int low_period)
+{
+    ports[i2c_num].timing.high_period = high_period;
+    ports[i2c_num].timing.low_period = low_period;
+    return ESP_OK;
+}
+
+esp_err_t i2c_set_data_timing(i2c_port_t i2c_num, int sample_time, int hold_time)
+{
+    ports[i2c_num].timing.sda_sample_time = sample_time;
+    ports[i2c_num].timing.sda_hold_time = hold_time;
+    return ESP_OK;
+}
+
+esp_err_t i2c_set_start_timing(i2c_port_t i2c_num, int setup_time, int hold_time)
+{
+    ports[i2c_num].timing.start_setup_time = setup_time;
+    ports[i2c_num].timing.start_hold_time = hold_time;
+    return ESP_OK;
+}
+
+esp_err_t i2c_set_stop_timing(i2c_port_t i2c_num, int setup_time, int hold_time)
+{
+    ports[i2c_num].timing.stop_setup_time = setup_time;
+    ports[i2c_num].timing.stop_hold_time = hold_time;
+    return ESP_OK;
+}
+
+void i2c_host_set_device(i2c_port_t i2c_num, i2c_host_device_t device, void* context)
+{
+    ports[i2c_num].device = device;
+    ports[i2c_num].context = context;
+}
+
+i2c_host_timing_t i2c_host_get_timing(i2c_port_t i2c_num)
+{
+    return ports[i2c_num].timing;
+}
+
+}
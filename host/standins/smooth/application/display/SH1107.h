@@ -0,0 +1,64 @@
+/****************************************************************************************
+ * smooth/application/display/SH1107.h - Host stand-in for the Smooth SH1107 commands
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace smooth::application::display
+{
+    // The SH1107 commands the display driver sends
+    enum SH1107Cmd : uint8_t
+    {
+        LowerColumnAddress = 0x00,
+        UpperColumnAddress = 0x10,
+        MemoryAddressingModePage = 0x20,
+        MemoryAddressingModeVertical = 0x21,
+        ContrastControl = 0x81,
+        SegmentRemapNormal = 0xA0,
+        SegmentRemapReverse = 0xA1,
+        EntireDisplayOff = 0xA4,
+        EntireDisplayOn = 0xA5,
+        NormalDisplay = 0xA6,
+        ReverseDisplay = 0xA7,
+        MultiplexRatio = 0xA8,
+        DcDcControl = 0xAD,
+        DisplayOff = 0xAE,
+        DisplayOn = 0xAF,
+        PageAddress0 = 0xB0,
+        CommonOutputScanDirPortrait = 0xC0,
+        CommonOutputScanDirLandscape = 0xC8,
+        DisplayOffset = 0xD3,
+        ClockDivide = 0xD5,
+        PreChargePeriod = 0xD9,
+        VcomDeselectLevel = 0xDB,
+        DisplayStartLine = 0xDC
+    };
+
+    // Display off, page addressing, 128 mux, start line and offset 0, display on
+    static constexpr std::array<uint8_t, 19> sh1107_init_cmds_1{
+        DisplayOff,
+        MemoryAddressingModePage,
+        ContrastControl, 0x2F,
+        SegmentRemapNormal,
+        CommonOutputScanDirPortrait,
+        MultiplexRatio, 0x7F,
+        DisplayOffset, 0x00,
+        DisplayStartLine, 0x00,
+        ClockDivide, 0x50,
+        PreChargePeriod, 0x22,
+        EntireDisplayOff,
+        NormalDisplay,
+        DisplayOn
+    };
+}
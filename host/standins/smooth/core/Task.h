@@ -0,0 +1,105 @@
+/****************************************************************************************
+ * smooth/core/Task.h - Host stand-in for the Smooth task
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <freertos/FreeRTOS.h>
+#include <smooth/core/logging/log.h>
+
+namespace smooth::core
+{
+    using logging::Log;
+
+    // The host has no task loop of its own.  start() only runs init(), the events queued
+    // for the task are run by host_run_events() and tick() is called by the test itself,
+    // so a test decides exactly when each task runs.
+    class Task
+    {
+        public:
+            Task(std::string task_name, uint32_t stack_size, uint32_t priority,
+                 std::chrono::milliseconds tick_interval, int core = tskNO_AFFINITY)
+                    : name(std::move(task_name)), stack_size(stack_size), priority(priority),
+                      tick_interval(tick_interval), core(core)
+            {
+            }
+
+            virtual ~Task() = default;
+
+            virtual void init()
+            {
+            }
+
+            virtual void tick()
+            {
+            }
+
+            void start()
+            {
+                init();
+            }
+
+            /// Host only - queue work for this task, called by the event queues of the task
+            void host_post(std::function<void()> work)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                events.push_back(std::move(work));
+            }
+
+            /// Host only - run the queued events, including events queued by the events
+            /// \return Returns the number of events run
+            size_t host_run_events()
+            {
+                size_t count = 0;
+
+                for (;;)
+                {
+                    std::function<void()> work;
+
+                    {
+                        std::lock_guard<std::mutex> lock(guard);
+
+                        if (events.empty())
+                        {
+                            return count;
+                        }
+
+                        work = std::move(events.front());
+                        events.pop_front();
+                    }
+
+                    work();
+                    count++;
+                }
+            }
+
+            const std::string& get_name() const
+            {
+                return name;
+            }
+
+        private:
+            std::string name;
+            uint32_t stack_size;
+            uint32_t priority;
+            std::chrono::milliseconds tick_interval;
+            int core;
+
+            std::mutex guard{};
+            std::deque<std::function<void()>> events{};
+    };
+}
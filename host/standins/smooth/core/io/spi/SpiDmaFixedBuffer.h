@@ -0,0 +1,54 @@
+/****************************************************************************************
+ * smooth/core/io/spi/SpiDmaFixedBuffer.h - Host stand-in for the Smooth DMA buffer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace smooth::core::io::spi
+{
+    // Any memory will do for the host SPI driver
+    template<typename T, size_t Size>
+    class SpiDmaFixedBuffer
+    {
+        public:
+            bool is_buffer_allocated() const
+            {
+                return buffer != nullptr;
+            }
+
+            T* data()
+            {
+                return buffer->data();
+            }
+
+            const T* data() const
+            {
+                return buffer->data();
+            }
+
+            T& operator[](size_t index)
+            {
+                return (*buffer)[index];
+            }
+
+            constexpr size_t size() const
+            {
+                return Size;
+            }
+
+        private:
+            std::unique_ptr<std::array<T, Size>> buffer{ std::make_unique<std::array<T, Size>>() };
+    };
+}
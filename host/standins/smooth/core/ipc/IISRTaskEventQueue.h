@@ -0,0 +1,26 @@
+/****************************************************************************************
+ * smooth/core/ipc/IISRTaskEventQueue.h - Host stand-in for the Smooth interrupt queue interface
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+namespace smooth::core::ipc
+{
+    template<typename T>
+    class IISRTaskEventQueue
+    {
+        public:
+            virtual ~IISRTaskEventQueue() = default;
+
+            /// Signal an item from an interrupt
+            virtual void signal(const T& data) = 0;
+    };
+}
@@ -0,0 +1,45 @@
+/****************************************************************************************
+ * smooth/core/ipc/ISRTaskEventQueue.h - Host stand-in for the Smooth interrupt queue
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <memory>
+#include <smooth/core/ipc/IISRTaskEventQueue.h>
+#include <smooth/core/ipc/TaskEventQueue.h>
+
+namespace smooth::core::ipc
+{
+    // The interrupt runs on the calling thread on the host, so the item is posted to the task
+    // like any other event
+    template<typename T, int Size>
+    class ISRTaskEventQueue : public IISRTaskEventQueue<T>
+    {
+        public:
+            static std::shared_ptr<ISRTaskEventQueue<T, Size>> create(Task& task, IEventListener<T>& listener)
+            {
+                return std::shared_ptr<ISRTaskEventQueue<T, Size>>(new ISRTaskEventQueue<T, Size>(task, listener));
+            }
+
+            void signal(const T& data) override
+            {
+                queue->push(data);
+            }
+
+        private:
+            ISRTaskEventQueue(Task& task, IEventListener<T>& listener)
+                    : queue(TaskEventQueue<T>::create(Size, task, listener))
+            {
+            }
+
+            std::shared_ptr<TaskEventQueue<T>> queue;
+    };
+}
@@ -0,0 +1,29 @@
+/****************************************************************************************
+ * smooth/core/ipc/Publisher.h - Host stand-in for the Smooth publisher
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+
+namespace smooth::core::ipc
+{
+    template<typename T>
+    class Publisher
+    {
+        public:
+            /// Push a copy of the item to every subscribing queue of the type
+            static void publish(const T& item)
+            {
+                Subscribers<T>::publish(item);
+            }
+    };
+}
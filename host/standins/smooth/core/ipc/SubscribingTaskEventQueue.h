@@ -0,0 +1,84 @@
+/****************************************************************************************
+ * smooth/core/ipc/SubscribingTaskEventQueue.h - Host stand-in for the Smooth subscribing queue
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <smooth/core/ipc/TaskEventQueue.h>
+
+namespace smooth::core::ipc
+{
+    template<typename T>
+    class SubscribingTaskEventQueue;
+
+    // The queues that receive what is published, one list per event type
+    template<typename T>
+    class Subscribers
+    {
+        public:
+            static void add(SubscribingTaskEventQueue<T>* queue)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                queues.push_back(queue);
+            }
+
+            static void remove(SubscribingTaskEventQueue<T>* queue)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                queues.erase(std::remove(queues.begin(), queues.end(), queue), queues.end());
+            }
+
+            static void publish(const T& item);
+
+        private:
+            static inline std::mutex guard{};
+            static inline std::vector<SubscribingTaskEventQueue<T>*> queues{};
+    };
+
+    template<typename T>
+    class SubscribingTaskEventQueue : public TaskEventQueue<T>
+    {
+        public:
+            static std::shared_ptr<SubscribingTaskEventQueue<T>> create(int size, Task& task,
+                                                                        IEventListener<T>& listener)
+            {
+                return std::shared_ptr<SubscribingTaskEventQueue<T>>(
+                        new SubscribingTaskEventQueue<T>(size, task, listener));
+            }
+
+            ~SubscribingTaskEventQueue() override
+            {
+                Subscribers<T>::remove(this);
+            }
+
+        private:
+            SubscribingTaskEventQueue(int size, Task& task, IEventListener<T>& listener)
+                    : TaskEventQueue<T>(size, task, listener)
+            {
+                Subscribers<T>::add(this);
+            }
+    };
+
+    template<typename T>
+    void Subscribers<T>::publish(const T& item)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        for (auto queue : queues)
+        {
+            queue->push(item);
+        }
+    }
+}
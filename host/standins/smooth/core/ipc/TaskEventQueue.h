@@ -0,0 +1,74 @@
+/****************************************************************************************
+ * smooth/core/ipc/TaskEventQueue.h - Host stand-in for the Smooth task event queue
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+
+namespace smooth::core::ipc
+{
+    // An event is posted to the task and handed to the listener when the task runs its events,
+    // the queue holds at most size events that have not been handed over yet
+    template<typename T>
+    class TaskEventQueue : public std::enable_shared_from_this<TaskEventQueue<T>>
+    {
+        public:
+            static std::shared_ptr<TaskEventQueue<T>> create(int size, Task& task, IEventListener<T>& listener)
+            {
+                return std::shared_ptr<TaskEventQueue<T>>(new TaskEventQueue<T>(size, task, listener));
+            }
+
+            virtual ~TaskEventQueue() = default;
+
+            bool push(const T& item)
+            {
+                if (pending >= size)
+                {
+                    return false;
+                }
+
+                pending++;
+                std::weak_ptr<TaskEventQueue<T>> self = this->shared_from_this();
+
+                task.host_post([self, item]()
+                               {
+                                   if (auto queue = self.lock())
+                                   {
+                                       queue->pending--;
+                                       queue->listener.event(item);
+                                   }
+                               });
+
+                return true;
+            }
+
+            int count() const
+            {
+                return pending;
+            }
+
+        protected:
+            TaskEventQueue(int size, Task& task, IEventListener<T>& listener)
+                    : size(size), task(task), listener(listener)
+            {
+            }
+
+        private:
+            int size;
+            Task& task;
+            IEventListener<T>& listener;
+            std::atomic<int> pending{ 0 };
+    };
+}
@@ -0,0 +1,101 @@
+/****************************************************************************************
+ * smooth/core/logging/log.h - Host stand-in for the Smooth log
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace smooth::core::logging
+{
+    // The fields of the format string are filled in order, format specs are ignored.  Errors
+    // and warnings always go to stderr, the other levels only when HOST_LOG is set.
+    class Log
+    {
+        public:
+            template<typename... Args>
+            static void error(const std::string& tag, const std::string& fmt, Args&& ... args)
+            {
+                write("E", tag, fmt, true, std::forward<Args>(args)...);
+            }
+
+            template<typename... Args>
+            static void warning(const std::string& tag, const std::string& fmt, Args&& ... args)
+            {
+                write("W", tag, fmt, true, std::forward<Args>(args)...);
+            }
+
+            template<typename... Args>
+            static void info(const std::string& tag, const std::string& fmt, Args&& ... args)
+            {
+                write("I", tag, fmt, false, std::forward<Args>(args)...);
+            }
+
+            template<typename... Args>
+            static void debug(const std::string& tag, const std::string& fmt, Args&& ... args)
+            {
+                write("D", tag, fmt, false, std::forward<Args>(args)...);
+            }
+
+            template<typename... Args>
+            static void verbose(const std::string& tag, const std::string& fmt, Args&& ... args)
+            {
+                write("V", tag, fmt, false, std::forward<Args>(args)...);
+            }
+
+        private:
+            template<typename... Args>
+            static void write(const char* level, const std::string& tag, const std::string& fmt, bool always,
+                              Args&& ... args)
+            {
+                static const bool verbose_enabled = std::getenv("HOST_LOG") != nullptr;
+
+                if (always || verbose_enabled)
+                {
+                    std::ostringstream out;
+                    size_t pos = 0;
+                    (format_field(out, fmt, pos, args), ...);
+                    out << fmt.substr(pos);
+                    std::cerr << level << " (" << tag << ") " << out.str() << std::endl;
+                }
+            }
+
+            template<typename T>
+            static void format_field(std::ostringstream& out, const std::string& fmt, size_t& pos, const T& value)
+            {
+                size_t open = fmt.find('{', pos);
+                size_t close = open == std::string::npos ? std::string::npos : fmt.find('}', open);
+
+                if (close == std::string::npos)
+                {
+                    return;
+                }
+
+                out << fmt.substr(pos, open - pos);
+
+                if constexpr (std::is_same_v<T, uint8_t> || std::is_same_v<T, int8_t>)
+                {
+                    out << static_cast<int>(value);
+                }
+                else
+                {
+                    out << value;
+                }
+
+                pos = close + 1;
+            }
+    };
+}
@@ -0,0 +1,148 @@
+/****************************************************************************************
+ * smooth/core/timer/Timer.h - Host stand-in for the Smooth timer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <smooth/core/ipc/TaskEventQueue.h>
+#include <smooth/core/timer/TimerExpiredEvent.h>
+
+namespace smooth::core::timer
+{
+    class Timer;
+
+    // Owns a timer, the timer stops when the owner goes away
+    class TimerOwner
+    {
+        public:
+            TimerOwner() = default;
+
+            explicit TimerOwner(std::shared_ptr<Timer> timer) : timer(std::move(timer))
+            {
+            }
+
+            Timer* operator->() const
+            {
+                return timer.get();
+            }
+
+        private:
+            std::shared_ptr<Timer> timer{};
+    };
+
+    // The host has no timer service, host_expire() posts the events of the timers that are due
+    // at a time the test chooses
+    class Timer
+    {
+        public:
+            using Queue = smooth::core::ipc::TaskEventQueue<TimerExpiredEvent>;
+
+            static TimerOwner create(int id, const std::weak_ptr<Queue>& event_queue, bool auto_reload,
+                                     std::chrono::milliseconds interval)
+            {
+                auto timer = std::shared_ptr<Timer>(new Timer(id, event_queue, auto_reload, interval));
+                std::lock_guard<std::mutex> lock(guard);
+                timers.push_back(timer);
+                return TimerOwner(timer);
+            }
+
+            void start()
+            {
+                start(interval);
+            }
+
+            void start(std::chrono::milliseconds new_interval)
+            {
+                interval = new_interval;
+                expiry = std::chrono::steady_clock::now() + interval;
+                running = true;
+            }
+
+            void stop()
+            {
+                running = false;
+            }
+
+            void reset()
+            {
+                start(interval);
+            }
+
+            bool is_running() const
+            {
+                return running;
+            }
+
+            int get_id() const
+            {
+                return id;
+            }
+
+            /// Host only - get the time the timer expires
+            std::chrono::steady_clock::time_point host_get_expiry() const
+            {
+                return expiry;
+            }
+
+            /// Host only - post the events of the running timers that expire by a time
+            /// \param now The time
+            /// \return Returns the number of events posted
+            static int host_expire(std::chrono::steady_clock::time_point now)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                int count = 0;
+
+                timers.erase(std::remove_if(timers.begin(), timers.end(),
+                                            [](const std::weak_ptr<Timer>& t) { return t.expired(); }),
+                             timers.end());
+
+                for (auto& weak : timers)
+                {
+                    auto timer = weak.lock();
+
+                    if (timer && timer->running && timer->expiry <= now)
+                    {
+                        timer->running = timer->auto_reload;
+                        timer->expiry += timer->interval;
+
+                        if (auto queue = timer->queue.lock())
+                        {
+                            queue->push(TimerExpiredEvent(timer->id));
+                            count++;
+                        }
+                    }
+                }
+
+                return count;
+            }
+
+        private:
+            Timer(int id, std::weak_ptr<Queue> queue, bool auto_reload, std::chrono::milliseconds interval)
+                    : id(id), queue(std::move(queue)), auto_reload(auto_reload), interval(interval)
+            {
+            }
+
+            int id;
+            std::weak_ptr<Queue> queue;
+            bool auto_reload;
+            std::chrono::milliseconds interval;
+            std::chrono::steady_clock::time_point expiry{};
+            bool running{ false };
+
+            static inline std::mutex guard{};
+            static inline std::vector<std::weak_ptr<Timer>> timers{};
+    };
+}
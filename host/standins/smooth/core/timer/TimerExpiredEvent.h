@@ -0,0 +1,34 @@
+/****************************************************************************************
+ * smooth/core/timer/TimerExpiredEvent.h - Host stand-in for the Smooth timer event
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+namespace smooth::core::timer
+{
+    class TimerExpiredEvent
+    {
+        public:
+            TimerExpiredEvent() = default;
+
+            explicit TimerExpiredEvent(int id) : id(id)
+            {
+            }
+
+            int get_id() const
+            {
+                return id;
+            }
+
+        private:
+            int id{ -1 };
+    };
+}
@@ -0,0 +1,54 @@
+/****************************************************************************************
+ * BranchingSetPx.h - The set_px_cb DisplayDriver had before it was made branch-free
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <lvgl/lvgl.h>
+
+namespace redstone::host
+{
+    /// The set_px_cb of the original DisplayDriver, kept so the benchmarks can compare the
+    /// current callback against it.  It tests the orientation and the colour on every pixel.
+    inline void branching_set_px_cb(struct _disp_drv_t* /*disp_drv*/, uint8_t* buf, lv_coord_t /*buf_w*/,
+                                    lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t /*opa*/)
+    {
+        static constexpr int SH1107_COLUMNS = 64;
+
+        uint16_t buf_index;
+        uint8_t bit_index;
+
+        if (LV_VER_RES_MAX > LV_HOR_RES_MAX)
+        {
+            // Potrait
+            buf_index = x + (SH1107_COLUMNS * (y >> 3));
+            bit_index = y & 0x07;
+        }
+        else
+        {
+            // Landscape
+            buf_index = y + (SH1107_COLUMNS * (x >> 3));
+            bit_index = x & 0x07;
+        }
+
+        if (color.full == 0)
+        {
+            // clear the bit
+            buf[buf_index] &= static_cast<uint8_t>(~(1 << bit_index));
+        }
+        else
+        {
+            // set the bit
+            buf[buf_index] |= static_cast<uint8_t>(1 << bit_index);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/****************************************************************************************
+ * HostBench.h - The timing loop and JSON report of the host benchmarks
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace redstone::host
+{
+    /// Keep the compiler from optimizing a value away
+    template<typename T>
+    inline void keep(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Each case is timed over a number of iterations a few times in a row and the fastest
+    // run is reported, the other runs are the ones the host got in the way of.  The results
+    // are written as JSON to the file given as the first argument, or to stdout.
+    class HostBench
+    {
+        public:
+            static constexpr int Runs = 5;
+
+            /// Constructor
+            /// \param suite The name of the benchmark program
+            /// \param argc The argument count of main
+            /// \param argv The arguments of main, an optional path of the JSON report
+            HostBench(std::string suite, int argc, char** argv)
+                    : suite(std::move(suite)), path(argc > 1 ? argv[1] : "")
+            {
+            }
+
+            /// Time a case
+            /// \param name The name of the case
+            /// \param iterations The number of calls in a run
+            /// \param body The code to time, called with the iteration number
+            /// \return Returns the fastest time per call in nanoseconds
+            template<typename Body>
+            double time(const std::string& name, size_t iterations, Body body)
+            {
+                double best = 0;
+
+                for (int run = 0; run < Runs; run++)
+                {
+                    auto start = std::chrono::steady_clock::now();
+
+                    for (size_t i = 0; i < iterations; i++)
+                    {
+                        body(i);
+                    }
+
+                    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                    double per_call = elapsed.count() / static_cast<double>(iterations);
+                    best = run == 0 ? per_call : std::min(best, per_call);
+                }
+
+                add(name, best, "ns/op", iterations);
+                return best;
+            }
+
+            /// Add a result that is not a timing, e.g. a byte count
+            /// \param name The name of the result
+            /// \param value The value
+            /// \param unit The unit of the value
+            /// \param iterations The number of samples the value is from
+            void add(const std::string& name, double value, const std::string& unit, size_t iterations = 1)
+            {
+                results.push_back(Result{ name, value, unit, iterations });
+                std::cerr << suite << "/" << name << ": " << value << " " << unit << std::endl;
+            }
+
+            /// Write the report
+            /// \return Returns the exit code of the benchmark program
+            int report() const
+            {
+                if (path.empty())
+                {
+                    write(std::cout);
+                    return 0;
+                }
+
+                std::ofstream out(path);
+                write(out);
+                return out.good() ? 0 : 1;
+            }
+
+        private:
+            struct Result
+            {
+                std::string name;
+                double value;
+                std::string unit;
+                size_t iterations;
+            };
+
+            void write(std::ostream& out) const
+            {
+                out << "{\n  \"suite\": \"" << suite << "\",\n  \"results\": [";
+
+                for (size_t i = 0; i < results.size(); i++)
+                {
+                    const Result& r = results[i];
+                    out << (i == 0 ? "\n" : ",\n") << "    { \"name\": \"" << r.name << "\", \"value\": " << r.value
+                        << ", \"unit\": \"" << r.unit << "\", \"iterations\": " << r.iterations << " }";
+                }
+
+                out << "\n  ]\n}\n";
+            }
+
+            std::string suite;
+            std::string path;
+            std::vector<Result> results{};
+    };
+}
@@ -0,0 +1,62 @@
+/****************************************************************************************
+ * HostTest.h - The checks of the host tests
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <cmath>
+#include <iostream>
+
+namespace redstone::host
+{
+    // The tests of a test program are plain functions run by run_test(), a failed check
+    // reports where it failed and the test goes on so all failures are seen in one run
+    class HostTest
+    {
+        public:
+            /// Run a test function
+            /// \param name The name of the test
+            /// \param test The test function
+            template<typename Test>
+            static void run_test(const char* name, Test test)
+            {
+                int before = failures;
+                test();
+                std::cout << (failures == before ? "PASS " : "FAIL ") << name << std::endl;
+            }
+
+            /// Record the result of a check
+            static bool check(bool passed, const char* expression, const char* file, int line)
+            {
+                if (!passed)
+                {
+                    failures++;
+                    std::cout << file << ":" << line << ": check failed: " << expression << std::endl;
+                }
+
+                return passed;
+            }
+
+            /// Get the exit code of the test program
+            static int result()
+            {
+                return failures == 0 ? 0 : 1;
+            }
+
+        private:
+            static inline int failures{ 0 };
+    };
+}
+
+#define HOST_CHECK(expr) \
+    redstone::host::HostTest::check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
+
+#define HOST_CHECK_EQ(actual, expected) \
+    redstone::host::HostTest::check((actual) == (expected), #actual " == " #expected, __FILE__, __LINE__)
+
+#define HOST_CHECK_NEAR(actual, expected, tolerance) \
+    redstone::host::HostTest::check(std::fabs(static_cast<double>(actual) - static_cast<double>(expected)) \
+                                    <= (tolerance), #actual " ~= " #expected, __FILE__, __LINE__)
@@ -0,0 +1,174 @@
+/****************************************************************************************
+ * SH1107Sim.h - A SH1107 on the host SPI bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#include "gui/SH1107FrameBuffer.h"
+
+namespace redstone::host
+{
+    // Decodes what is sent on the host SPI bus the way the SH1107 does, with the D/C line
+    // telling commands from display data, and keeps its display ram.  The page addressing
+    // commands are followed, the other commands are only counted, with their argument byte
+    // skipped so it is not taken for a command.
+    class SH1107Sim
+    {
+        public:
+            static constexpr int Columns = 128;
+            static constexpr int Pages = 16;
+
+            // What went over the bus
+            struct Counters
+            {
+                uint32_t transactions;
+                uint32_t command_transactions;
+                uint32_t data_transactions;
+                uint32_t command_bytes;
+                uint32_t data_bytes;
+            };
+
+            /// Constructor
+            /// \param data_command The D/C gpio pin, low for a command
+            explicit SH1107Sim(gpio_num_t data_command) : data_command(data_command)
+            {
+            }
+
+            /// Receive the bytes sent on an SPI bus
+            /// \param host The bus
+            void attach(spi_host_device_t host)
+            {
+                spi_bus_host_set_sink(host, receive, this);
+            }
+
+            /// Get the bus counters
+            const Counters& get_counters() const
+            {
+                return counters;
+            }
+
+            /// Start counting from zero
+            void reset_counters()
+            {
+                counters = Counters{};
+            }
+
+            /// Get a byte of the display ram
+            uint8_t get_ram(int page, int column) const
+            {
+                return ram[page * Columns + column];
+            }
+
+            /// Copy the columns the driver uses into a frame buffer, e.g. to write it as an image
+            /// \return Returns the frame buffer
+            SH1107FrameBuffer to_frame_buffer() const
+            {
+                SH1107FrameBuffer frame_buffer{};
+                int first_dirty;
+                size_t length;
+
+                for (int page = 0; page < SH1107FrameBuffer::Pages; page++)
+                {
+                    frame_buffer.update_page(page, 0, SH1107FrameBuffer::Columns - 1, &ram[page * Columns],
+                                             first_dirty, length);
+                }
+
+                return frame_buffer;
+            }
+
+            /// Check that the columns the driver uses show what a frame buffer holds
+            /// \param frame_buffer The frame buffer
+            /// \return Returns true if every byte is the same
+            bool shows(const SH1107FrameBuffer& frame_buffer) const
+            {
+                for (int page = 0; page < SH1107FrameBuffer::Pages; page++)
+                {
+                    for (int column = 0; column < SH1107FrameBuffer::Columns; column++)
+                    {
+                        if (get_ram(page, column) != frame_buffer.data()[page * SH1107FrameBuffer::Columns + column])
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+        private:
+            static void receive(void* context, const uint8_t* data, size_t length)
+            {
+                static_cast<SH1107Sim*>(context)->receive(data, length);
+            }
+
+            void receive(const uint8_t* data, size_t length)
+            {
+                bool is_data = gpio_get_level(data_command) != 0;
+                counters.transactions++;
+                counters.command_transactions += is_data ? 0 : 1;
+                counters.data_transactions += is_data ? 1 : 0;
+                counters.command_bytes += is_data ? 0 : static_cast<uint32_t>(length);
+                counters.data_bytes += is_data ? static_cast<uint32_t>(length) : 0;
+
+                for (size_t i = 0; i < length; i++)
+                {
+                    if (is_data)
+                    {
+                        write_data(data[i]);
+                    }
+                    else
+                    {
+                        command(data[i]);
+                    }
+                }
+            }
+
+            void write_data(uint8_t value)
+            {
+                ram[page * Columns + column] = value;
+                column = (column + 1) % Columns;
+            }
+
+            void command(uint8_t cmd)
+            {
+                if (argument_pending)
+                {
+                    argument_pending = false;
+                }
+                else if (cmd <= 0x0F)
+                {
+                    column = (column & 0x70) | cmd;
+                }
+                else if (cmd <= 0x17)
+                {
+                    column = ((cmd & 0x07) << 4) | (column & 0x0F);
+                }
+                else if (cmd >= 0xB0 && cmd <= 0xBF)
+                {
+                    page = cmd & 0x0F;
+                }
+                else
+                {
+                    // the double byte commands: contrast, multiplex, dc-dc, offset, clock,
+                    // pre-charge, vcom and start line
+                    argument_pending = cmd == 0x81 || cmd == 0xA8 || cmd == 0xAD || cmd == 0xD3 || cmd == 0xD5
+                                       || cmd == 0xD9 || cmd == 0xDB || cmd == 0xDC;
+                }
+            }
+
+            gpio_num_t data_command;
+            std::array<uint8_t, Columns * Pages> ram{};
+            int page{ 0 };
+            int column{ 0 };
+            bool argument_pending{ false };
+            Counters counters{};
+    };
+}
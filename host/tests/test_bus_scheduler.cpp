@@ -0,0 +1,291 @@
+/****************************************************************************************
+ * test_bus_scheduler.cpp - Runs the bus scheduler on its own wakeups against a simulated I2C bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "model/BusScheduler.h"
+#include "model/DHT12Sensor.h"
+#include "HostTest.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+using Clock = ISensor::Clock;
+
+// A DHT12 on a bus that can NACK the next transfers and can be slow, the time of every
+// transfer is kept so the test can see when the bus was used
+class SimulatedBus : public II2CBus
+{
+    public:
+        Result write(uint8_t address, const uint8_t* data, size_t length, milliseconds timeout) override
+        {
+            return transfer();
+        }
+
+        Result read(uint8_t address, uint8_t* data, size_t length, milliseconds timeout) override
+        {
+            Result result = transfer();
+
+            if (result == Result::Ok && length == 5)
+            {
+                // 45.0 %RH, 22.5 degC and the checksum
+                const uint8_t reading[5] = { 45, 0, 22, 5, 72 };
+                std::copy(reading, reading + 5, data);
+            }
+
+            return result;
+        }
+
+        void report_data_error() override
+        {
+            data_errors++;
+        }
+
+        Clock::time_point now{};
+        int data_errors{ 0 };
+        std::vector<Clock::time_point> transfer_times{};
+        int nacks_left{ 0 };
+        milliseconds stall{ 0 };
+
+    private:
+        Result transfer()
+        {
+            transfer_times.push_back(now);
+
+            if (stall.count() > 0)
+            {
+                std::this_thread::sleep_for(stall);
+                return Result::Timeout;
+            }
+
+            if (nacks_left > 0)
+            {
+                nacks_left--;
+                return Result::Nack;
+            }
+
+            return Result::Ok;
+        }
+};
+
+struct RunResult
+{
+    uint32_t sessions{ 0 };
+    uint32_t readings{ 0 };
+};
+
+// The PollSensorTask loop: run a session, then sleep until the scheduler has work again
+template<size_t MaxSensors>
+static RunResult run_until(BusScheduler<MaxSensors>& scheduler, SimulatedBus& bus, Clock::time_point start,
+                           Clock::time_point end)
+{
+    RunResult result{};
+    auto now = start;
+
+    while (now < end)
+    {
+        bus.now = now;
+        scheduler.run(now, [&result](size_t, ISensor&, const MultiChannelSample&) { result.readings++; });
+        result.sessions++;
+        now = scheduler.get_next_run_time(now);
+    }
+
+    return result;
+}
+
+static const Clock::time_point Start = Clock::time_point{} + hours(1);
+
+// A burst is 3 reads of 2 transfers, the task only wakes up for those 6 transfers instead
+// of every second
+static void test_wakeups_follow_the_work()
+{
+    SimulatedBus bus;
+    DHT12Sensor sensor(bus, 0x5C);
+    sensor.set_period(seconds(30));
+    BusScheduler<2> scheduler(seconds(5));
+    scheduler.add_sensor(sensor);
+
+    auto result = run_until(scheduler, bus, Start, Start + hours(1));
+
+    HOST_CHECK_EQ(result.readings, 120u);
+    HOST_CHECK_EQ(bus.transfer_times.size(), 6u * result.readings);
+
+    // every wakeup used the bus, against 3600 wakeups of a 1 sec tick
+    HOST_CHECK_EQ(result.sessions, static_cast<uint32_t>(bus.transfer_times.size()));
+
+    if (bus.transfer_times.size() >= 6)
+    {
+        HOST_CHECK(bus.transfer_times[1] == bus.transfer_times[0]);
+        HOST_CHECK(bus.transfer_times[2] == bus.transfer_times[0] + seconds(2));
+        HOST_CHECK(bus.transfer_times[4] == bus.transfer_times[0] + seconds(4));
+        HOST_CHECK(bus.transfer_times[6] == bus.transfer_times[0] + seconds(30));
+    }
+}
+
+// A NACK is retried when its backoff ends, not on the next tick after it
+static void test_nack_backoff()
+{
+    SimulatedBus bus;
+    bus.nacks_left = 2;
+    DHT12Sensor sensor(bus, 0x5C);
+    sensor.set_period(seconds(30));
+    BusScheduler<2> scheduler(seconds(5));
+    scheduler.add_sensor(sensor);
+
+    auto result = run_until(scheduler, bus, Start, Start + seconds(20));
+
+    HOST_CHECK_EQ(result.readings, 1u);
+    HOST_CHECK_EQ(sensor.get_acquisition().get_nack_count(), 2u);
+    HOST_CHECK_EQ(sensor.get_acquisition().get_retry_count(), 2u);
+    HOST_CHECK_EQ(result.sessions, static_cast<uint32_t>(bus.transfer_times.size()));
+
+    if (bus.transfer_times.size() >= 3)
+    {
+        // backoffs of 1 and 2 sec
+        HOST_CHECK(bus.transfer_times[1] - bus.transfer_times[0] == seconds(1));
+        HOST_CHECK(bus.transfer_times[2] - bus.transfer_times[1] == seconds(2));
+    }
+}
+
+// A DHT12 that never answers is given up after max_attempts and read again a period after
+// the reading was due
+static void test_nack_gives_up()
+{
+    SimulatedBus bus;
+    bus.nacks_left = 1000;
+    DHT12Sensor sensor(bus, 0x5C);
+    sensor.set_period(seconds(30));
+    BusScheduler<2> scheduler(seconds(5));
+    scheduler.add_sensor(sensor);
+
+    auto result = run_until(scheduler, bus, Start, Start + seconds(29));
+
+    HOST_CHECK_EQ(result.readings, 0u);
+    HOST_CHECK_EQ(scheduler.get_failure_count(), 1u);
+    HOST_CHECK_EQ(bus.transfer_times.size(), 4u);
+    HOST_CHECK(scheduler.get_next_run_time(Start + seconds(29)) == Start + seconds(30));
+}
+
+// A bus that times out costs one transfer timeout per sensor and session, the other
+// sensors on the bus are not held up by more than that
+static void test_slow_bus()
+{
+    SimulatedBus bus;
+    bus.stall = milliseconds(15);
+    DHT12Sensor first(bus, 0x5C);
+    DHT12Sensor second(bus, 0x5D);
+    BusScheduler<2> scheduler(seconds(5));
+    scheduler.add_sensor(first);
+    scheduler.add_sensor(second);
+
+    auto now = Start;
+
+    for (int session = 0; session < 8; session++)
+    {
+        size_t transfers = bus.transfer_times.size();
+        auto started = steady_clock::now();
+
+        bus.now = now;
+        scheduler.run(now, [](size_t, ISensor&, const MultiChannelSample&) {});
+
+        auto blocked = steady_clock::now() - started;
+        HOST_CHECK(bus.transfer_times.size() - transfers <= 2);
+        HOST_CHECK(blocked < milliseconds(2 * 15 + 20));
+
+        now = scheduler.get_next_run_time(now);
+    }
+
+    HOST_CHECK_EQ(first.get_acquisition().get_timeout_count() + second.get_acquisition().get_timeout_count(),
+                  static_cast<uint32_t>(bus.transfer_times.size()));
+}
+
+struct GroupingResult
+{
+    double sessions_per_minute;
+    double busy_ms_per_minute;
+    uint32_t readings;
+};
+
+// Sensors with periods of 30, 33, 37 and 41 sec for 10 minutes, a session is a wakeup that used
+// the bus and the busy time is the transfers at the 0.8 ms read cost of a DHT12 at 100 kHz
+static GroupingResult simulate_grouping(size_t sensor_count, milliseconds group_window)
+{
+    constexpr int Minutes = 10;
+    const seconds periods[] = { seconds(30), seconds(33), seconds(37), seconds(41) };
+
+    SimulatedBus bus;
+    std::vector<std::unique_ptr<DHT12Sensor>> sensors;
+    BusScheduler<4> scheduler(group_window);
+
+    for (size_t i = 0; i < sensor_count; i++)
+    {
+        sensors.push_back(std::make_unique<DHT12Sensor>(bus, static_cast<uint8_t>(0x5C + i)));
+        sensors.back()->set_period(periods[i]);
+        scheduler.add_sensor(*sensors.back());
+    }
+
+    uint32_t sessions = 0;
+    uint32_t readings = 0;
+    auto now = Start;
+
+    while (now < Start + minutes(Minutes))
+    {
+        size_t transfers = bus.transfer_times.size();
+        bus.now = now;
+        scheduler.run(now, [&readings](size_t, ISensor&, const MultiChannelSample&) { readings++; });
+        sessions += bus.transfer_times.size() > transfers ? 1 : 0;
+        now = scheduler.get_next_run_time(now);
+    }
+
+    double busy_us = static_cast<double>(bus.transfer_times.size() * sensors.front()->get_read_cost().count());
+    return GroupingResult{ static_cast<double>(sessions) / Minutes, busy_us / 1000.0 / Minutes, readings };
+}
+
+// Grouping sensors that are almost due into one session cuts the wakeups that use the bus,
+// the bus busy time only depends on the number of readings
+static void test_grouping()
+{
+    std::cout << "sensors | no grouping | 5 s window | 10 s window   (sessions / busy ms per minute)" << std::endl;
+
+    for (size_t count = 1; count <= 4; count++)
+    {
+        GroupingResult none = simulate_grouping(count, milliseconds(0));
+        GroupingResult five = simulate_grouping(count, seconds(5));
+        GroupingResult ten = simulate_grouping(count, seconds(10));
+
+        std::cout << "   " << count << "    | " << none.sessions_per_minute << " / " << none.busy_ms_per_minute
+                  << " | " << five.sessions_per_minute << " / " << five.busy_ms_per_minute
+                  << " | " << ten.sessions_per_minute << " / " << ten.busy_ms_per_minute << std::endl;
+
+        // about 8 ms of bus time per minute for each DHT12, however they are grouped
+        HOST_CHECK(none.busy_ms_per_minute > 6.0 * count && none.busy_ms_per_minute < 11.0 * count);
+        HOST_CHECK(std::fabs(five.busy_ms_per_minute - none.busy_ms_per_minute) < 0.15 * none.busy_ms_per_minute);
+        HOST_CHECK(std::fabs(ten.busy_ms_per_minute - none.busy_ms_per_minute) < 0.15 * none.busy_ms_per_minute);
+
+        HOST_CHECK(five.sessions_per_minute <= none.sessions_per_minute);
+        HOST_CHECK(ten.sessions_per_minute <= five.sessions_per_minute);
+
+        if (count > 1)
+        {
+            HOST_CHECK(ten.sessions_per_minute < none.sessions_per_minute);
+        }
+    }
+}
+
+int main()
+{
+    HostTest::run_test("wakeups follow the work", test_wakeups_follow_the_work);
+    HostTest::run_test("nack backoff", test_nack_backoff);
+    HostTest::run_test("nack gives up", test_nack_gives_up);
+    HostTest::run_test("slow bus", test_slow_bus);
+    HostTest::run_test("grouping", test_grouping);
+    return HostTest::result();
+}
@@ -0,0 +1,108 @@
+/****************************************************************************************
+ * test_envir_formulas.cpp - Checks the float formulas against a double precision reference
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "model/EnvirFormulas.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+// The sweep covers the DHT12 range the views show, 0 to 60 degC by 0.1 degC and
+// 0 to 100 %RH by 0.1 %RH
+static constexpr int TempSteps = 600;
+static constexpr int HumiditySteps = 1000;
+
+// The largest differences seen on the sweep are 0.000205 degF and 0.0000198 degC, the
+// heat index error is a few float ulps of values up to 640 degF
+static constexpr double MaxHeatIndexErrorF = 0.00025;
+static constexpr double MaxDewPointErrorC = 0.00002;
+
+// The formulas as they were written before the float rewrite, in double precision
+static double reference_heat_index_fahrenheit(double temp_deg_f, double humidity)
+{
+    double heat_index = 0.5 * (temp_deg_f + 61.0 + ((temp_deg_f - 68) * 1.2) + (humidity * 0.094));
+
+    if (heat_index > 79)
+    {
+        heat_index = -42.379 + 2.04901523 * temp_deg_f + 10.14333127 * humidity
+                     + -0.22475541 * temp_deg_f * humidity
+                     + -0.00683783 * pow(temp_deg_f, 2)
+                     + -0.05481717 * pow(humidity, 2)
+                     + 0.00122874 * pow(temp_deg_f, 2) * humidity
+                     + 0.00085282 * temp_deg_f * pow(humidity, 2)
+                     + -0.00000199 * pow(temp_deg_f, 2) * pow(humidity, 2);
+
+        if (humidity < 13 && temp_deg_f >= 80.0 && temp_deg_f <= 112.0)
+        {
+            heat_index -= ((13.0 - humidity) * 0.25) * sqrt((17.0 - fabs(temp_deg_f - 95.0)) * 0.05882);
+        }
+
+        if (humidity > 85.0 && temp_deg_f >= 80.0 && temp_deg_f <= 87.0)
+        {
+            heat_index += ((humidity - 85.0) * 0.1) * ((87.0 - temp_deg_f) * 0.2);
+        }
+    }
+
+    return heat_index;
+}
+
+static double reference_dew_point_celsius(double temp_deg_c, double humidity)
+{
+    return temp_deg_c - (14.55 + 0.114 * temp_deg_c) * (1 - (0.01 * humidity))
+           - pow(((2.5 + 0.007 * temp_deg_c) * (1 - (0.01 * humidity))), 3)
+           - (15.9 + 0.117 * temp_deg_c) * pow((1 - (0.01 * humidity)), 14);
+}
+
+static void test_heat_index()
+{
+    double max_error = 0;
+
+    for (int t = 0; t <= TempSteps; t++)
+    {
+        for (int h = 0; h <= HumiditySteps; h++)
+        {
+            float temp_deg_f = ((t * 0.1f * 9.0f) / 5.0f) + 32.0f;
+            float humidity = h * 0.1f;
+            double expected = reference_heat_index_fahrenheit(temp_deg_f, humidity);
+            double error = std::fabs(EnvirFormulas::heat_index_fahrenheit(temp_deg_f, humidity) - expected);
+            max_error = std::max(max_error, error);
+        }
+    }
+
+    std::cout << "heat index max error " << max_error << " degF" << std::endl;
+    HOST_CHECK(max_error <= MaxHeatIndexErrorF);
+}
+
+static void test_dew_point()
+{
+    double max_error = 0;
+
+    for (int t = 0; t <= TempSteps; t++)
+    {
+        for (int h = 0; h <= HumiditySteps; h++)
+        {
+            float temp_deg_c = t * 0.1f;
+            float humidity = h * 0.1f;
+            double expected = reference_dew_point_celsius(temp_deg_c, humidity);
+            double error = std::fabs(EnvirFormulas::dew_point_celsius(temp_deg_c, humidity) - expected);
+            max_error = std::max(max_error, error);
+        }
+    }
+
+    std::cout << "dew point max error " << max_error << " degC" << std::endl;
+    HOST_CHECK(max_error <= MaxDewPointErrorC);
+}
+
+int main()
+{
+    HostTest::run_test("heat index", test_heat_index);
+    HostTest::run_test("dew point", test_dew_point);
+    return HostTest::result();
+}
@@ -0,0 +1,160 @@
+/****************************************************************************************
+ * test_fixed_point_text.cpp - Checks FixedPointText against ostringstream and that it does not allocate
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include "gui/FixedPointText.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+// Count every allocation of the program
+static std::atomic<size_t> allocations{ 0 };
+
+void* operator new(size_t size)
+{
+    allocations++;
+
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+static std::string expected_text(std::ostringstream& stream, float value, int precision, const char* suffix)
+{
+    stream.str("");
+    stream << std::fixed << std::setprecision(precision) << value << suffix;
+    return stream.str();
+}
+
+// 2 million values across the ranges the content panes show, the rounding ties of every
+// precision and random bit patterns up to the largest value the 64 bit scaling can hold
+static void test_matches_ostringstream()
+{
+    static constexpr size_t Values = 2000000;
+    static const char* suffixes[] = { "°F", " %RH", "°C", "" };
+
+    std::mt19937 random(2026);
+    std::uniform_real_distribution<float> sensor_range(-100.0f, 200.0f);
+    std::uniform_int_distribution<uint32_t> bits(0, 0xFFFFFFFF);
+    std::ostringstream stream;
+    size_t mismatches = 0;
+    size_t checked = 0;
+
+    for (size_t i = 0; i < Values; i++)
+    {
+        float value;
+
+        switch (i % 4)
+        {
+            case 0:
+            case 1:
+                value = sensor_range(random);
+                break;
+            case 2:
+            {
+                // ties such as 72.25 at precision 1 and 0.5 at precision 0
+                int precision = static_cast<int>(i / 4) % 4;
+                float step = 1.0f / static_cast<float>(1 << (precision + 1));
+                value = static_cast<float>(static_cast<int>(bits(random) % 4000) - 2000) * step;
+                break;
+            }
+            default:
+            {
+                uint32_t pattern = bits(random);
+                std::memcpy(&value, &pattern, sizeof(value));
+
+                if (!(std::fabs(value) < 1e15f))
+                {
+                    value = std::ldexp(static_cast<float>(pattern & 0xFFFFFF), -20);
+                }
+                break;
+            }
+        }
+
+        int precision = static_cast<int>(i % 4);
+        const char* suffix = suffixes[(i / 4) % 4];
+
+        FixedPointText<32> text{};
+        text.format(value, precision, suffix);
+        std::string expected = expected_text(stream, value, precision, suffix);
+
+        if (expected != text.c_str())
+        {
+            if (mismatches < 5)
+            {
+                std::cout << "value " << std::setprecision(9) << value << " precision " << precision
+                          << ": expected \"" << expected << "\", got \"" << text.c_str() << "\"" << std::endl;
+            }
+
+            mismatches++;
+        }
+
+        checked++;
+    }
+
+    HOST_CHECK_EQ(checked, Values);
+    HOST_CHECK_EQ(mismatches, 0u);
+}
+
+static void test_special_values()
+{
+    FixedPointText<16> text{};
+    HOST_CHECK(std::string(text.format(0.0f, 1, "°C")) == "0.0°C");
+    HOST_CHECK(std::string(text.format(-0.04f, 1, "°C")) == "-0.0°C");
+    HOST_CHECK(std::string(text.format(NAN, 1, "°C")) == "nan°C");
+    HOST_CHECK(std::string(text.format(-INFINITY, 0, "")) == "-inf");
+
+    // a text that does not fit is truncated and still null terminated
+    FixedPointText<6> small{};
+    HOST_CHECK(std::string(small.format(123.45f, 2, "°F")) == "123.4");
+}
+
+// Formatting a value must never allocate, it runs for every sample in the gui task
+static void test_no_allocation()
+{
+    FixedPointText<16> text{};
+    FixedPointText<16> previous{};
+    size_t before = allocations;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        text.format(static_cast<float>(i) * 0.01f - 40.0f, i % 4, " %RH");
+        previous = text;
+    }
+
+    HOST_CHECK_EQ(allocations - before, 0u);
+    HOST_CHECK(previous == text);
+}
+
+int main()
+{
+    HostTest::run_test("matches ostringstream", test_matches_ostringstream);
+    HostTest::run_test("special values", test_special_values);
+    HostTest::run_test("no allocation", test_no_allocation);
+    return HostTest::result();
+}
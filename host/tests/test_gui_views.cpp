@@ -0,0 +1,245 @@
+/****************************************************************************************
+ * test_gui_views.cpp - Runs the gui stack against the host SH1107 and steps through the views
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/Publisher.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+#include <smooth/core/timer/Timer.h>
+#include "gui/LvglTask.h"
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
+#include "HostTest.h"
+#include "SH1107Sim.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+using namespace smooth::core::ipc;
+using namespace smooth::core::timer;
+
+// Run the timers and the events of the task in real time, LittlevGL reads esp_timer
+static void run_for(LvglTask& task, milliseconds duration)
+{
+    auto end = steady_clock::now() + duration;
+
+    while (steady_clock::now() < end)
+    {
+        Timer::host_expire(steady_clock::now());
+        task.host_run_events();
+        std::this_thread::sleep_for(milliseconds(2));
+    }
+}
+
+static void write_pbm(const SH1107FrameBuffer& frame_buffer, const std::string& name)
+{
+    std::ofstream out(name, std::ios::binary);
+    frame_buffer.write_pbm(out, true);
+}
+
+static bool is_blank(const SH1107FrameBuffer& frame_buffer)
+{
+    for (auto byte : frame_buffer.data())
+    {
+        if (byte != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// The visible 128 x 22 content pane, the trend chart once the trend view is shown
+static lv_obj_t* find_content_pane()
+{
+    for (lv_obj_t* child = lv_obj_get_child(lv_scr_act(), NULL); child != NULL;
+         child = lv_obj_get_child(lv_scr_act(), child))
+    {
+        if (!lv_obj_get_hidden(child) && lv_obj_get_height(child) == 22)
+        {
+            return child;
+        }
+    }
+
+    return nullptr;
+}
+
+// A new trend point only sends the pages around it, a redraw of the chart sends all of it
+static void check_trend_point(LvglTask& task, SH1107Sim& display)
+{
+    const ViewController& view_controller = task.get_view_controller();
+    uint32_t label_redraws = view_controller.get_label_redraw_count();
+    uint32_t trend_points = view_controller.get_trend_point_count();
+
+    display.reset_counters();
+    Publisher<SampleLog::Record>::publish(SampleLog::Record{ 330, PackedSample::pack(26.0f, 60.0f) });
+    run_for(task, milliseconds(200));
+    SH1107Sim::Counters point = display.get_counters();
+
+    HOST_CHECK_EQ(view_controller.get_trend_point_count(), trend_points + 1);
+    HOST_CHECK_EQ(view_controller.get_label_redraw_count(), label_redraws);
+
+    lv_obj_t* chart = find_content_pane();
+    HOST_CHECK(chart != nullptr);
+
+    if (chart != nullptr)
+    {
+        display.reset_counters();
+        lv_obj_invalidate(chart);
+        task.request_refresh();
+        run_for(task, milliseconds(200));
+        SH1107Sim::Counters full = display.get_counters();
+
+        std::cout << "trend point: " << point.data_bytes * 8 << " pixels, " << point.data_bytes << " data bytes, "
+                  << point.transactions << " transactions" << std::endl;
+        std::cout << "chart redraw: " << full.data_bytes * 8 << " pixels, " << full.data_bytes << " data bytes, "
+                  << full.transactions << " transactions" << std::endl;
+
+        HOST_CHECK(point.data_bytes > 0);
+        HOST_CHECK(point.data_bytes * 4 <= full.data_bytes);
+    }
+}
+
+// A press right after the input driver read the release is read on the next LittlevGL run,
+// not when the LV_INDEV_DEF_READ_PERIOD of the input driver's own task comes around
+static void check_press_latency(LvglTask& task)
+{
+    const MenuPane& menu_pane = task.get_view_controller().get_menu_pane();
+
+    gpio_host_drive_input(GPIO_NUM_35, 0);
+    run_for(task, milliseconds(150));
+    gpio_host_drive_input(GPIO_NUM_35, 1);
+
+    // past the debounce window, well within the read period
+    run_for(task, milliseconds(30));
+    gpio_host_drive_input(GPIO_NUM_35, 0);
+    run_for(task, milliseconds(30));
+
+    std::cout << "press read after " << menu_pane.get_last_press_latency_us() << " us" << std::endl;
+    HOST_CHECK(!task.get_view_controller().has_pending_input());
+    HOST_CHECK(menu_pane.get_last_press_latency_us() < 10 * 1000);
+
+    gpio_host_drive_input(GPIO_NUM_35, 1);
+    run_for(task, milliseconds(200));
+}
+
+// Counts the trace dump requests, it stands in for App
+class TraceDumpListener : public smooth::core::Task, public IEventListener<TraceDumpRequest>
+{
+    public:
+        TraceDumpListener() : Task("TraceDumpListener", 4096, 5, seconds(60)),
+                              queue(SubscribingTaskEventQueue<TraceDumpRequest>::create(1, *this, *this))
+        {
+        }
+
+        void event(const TraceDumpRequest& /*event*/) override
+        {
+            count++;
+        }
+
+        int count{ 0 };
+
+    private:
+        std::shared_ptr<SubscribingTaskEventQueue<TraceDumpRequest>> queue;
+};
+
+// A long press asks for a trace dump at its release and stays on the view it was made on
+static void check_long_press(LvglTask& task, SH1107Sim& display)
+{
+    TraceDumpListener listener;
+    SH1107FrameBuffer before = display.to_frame_buffer();
+
+    gpio_host_drive_input(GPIO_NUM_35, 0);
+    run_for(task, milliseconds(MenuPane::TraceDumpPressUs / 1000 + 100));
+    gpio_host_drive_input(GPIO_NUM_35, 1);
+    run_for(task, milliseconds(200));
+    listener.host_run_events();
+
+    HOST_CHECK_EQ(listener.count, 1);
+    HOST_CHECK(display.to_frame_buffer().data() == before.data());
+}
+
+// Every view is drawn and flushed, each button press shows a different view
+static void test_step_through_views()
+{
+    SH1107Sim display(GPIO_NUM_27);
+    display.attach(VSPI_HOST);
+
+    // the button has an external pull-up, it is released
+    gpio_host_drive_input(GPIO_NUM_35, 1);
+
+    LvglTask task;
+    task.start();
+    run_for(task, milliseconds(200));
+
+    EnvirValue value{};
+    value.set_temperture_degree_C(22.5f);
+    value.set_relative_humidity(45.0f);
+    Publisher<EnvirValue>::publish(value);
+
+    // the trend chart only moves with the samples recorded every 30 sec
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        Publisher<SampleLog::Record>::publish(SampleLog::Record{ i * 30, PackedSample::pack(22.0f + i * 0.2f, 45.0f) });
+        task.host_run_events();
+    }
+
+    run_for(task, milliseconds(200));
+
+    SH1107FrameBuffer previous = display.to_frame_buffer();
+    HOST_CHECK(!is_blank(previous));
+    write_pbm(previous, "view_0.pbm");
+
+    // the view switch frames are measured from here on
+    TimingStats::instance().take_summary(TimingStats::DisplayFrame);
+
+    for (int view = 1; view < ViewController::ViewCount; view++)
+    {
+        gpio_host_drive_input(GPIO_NUM_35, 0);
+        run_for(task, milliseconds(100));
+        gpio_host_drive_input(GPIO_NUM_35, 1);
+        run_for(task, milliseconds(200));
+
+        SH1107FrameBuffer shown = display.to_frame_buffer();
+        HOST_CHECK(shown.data() != previous.data());
+        write_pbm(shown, "view_" + std::to_string(view) + ".pbm");
+        previous = shown;
+    }
+
+    HOST_CHECK(display.get_counters().data_transactions > 0);
+
+    // the SPI stand-in sends at once, so on the host a frame is the render and flush CPU time
+    auto frames = TimingStats::instance().take_summary(TimingStats::DisplayFrame);
+    std::cout << "view switch frame: " << frames.count << " frames, p50 " << frames.p50 / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ
+              << " us, max " << frames.max / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ << " us" << std::endl;
+    HOST_CHECK(frames.count > 0);
+
+    // the last view is the trend chart
+    check_trend_point(task, display);
+    check_press_latency(task);
+    check_long_press(task, display);
+}
+
+int main()
+{
+    HostTest::run_test("step through views", test_step_through_views);
+    return HostTest::result();
+}
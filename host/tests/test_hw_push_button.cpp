@@ -0,0 +1,179 @@
+/****************************************************************************************
+ * test_hw_push_button.cpp - Checks the button debounce with synthetic bounce sequences
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#include <random>
+#include <vector>
+#include <esp_timer.h>
+#include "gui/HwPushButton.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr gpio_num_t Pin = GPIO_NUM_35;
+
+// Keeps what the interrupt handler signals
+class RecordingQueue : public smooth::core::ipc::IISRTaskEventQueue<HwButtonEdge>
+{
+    public:
+        void signal(const HwButtonEdge& data) override
+        {
+            edges.push_back(data);
+        }
+
+        std::vector<HwButtonEdge> edges{};
+};
+
+// Set the pin at a time in microseconds, the interrupt handler runs on each edge
+static void drive(int64_t time_us, uint32_t level)
+{
+    esp_timer_host_set_time(time_us);
+    gpio_host_drive_input(Pin, level);
+}
+
+// The contacts bounce for a few hundred microseconds before settling on the new level
+static void bounce_to(int64_t time_us, uint32_t level, const std::vector<int64_t>& bounce_us)
+{
+    uint32_t current = level;
+    drive(time_us, current);
+
+    for (auto offset : bounce_us)
+    {
+        current = 1 - current;
+        drive(time_us + offset, current);
+    }
+
+    if (current != level)
+    {
+        drive(time_us + bounce_us.back() + 100, level);
+    }
+}
+
+static void test_clean_press()
+{
+    drive(0, 1);
+    RecordingQueue queue;
+    HwPushButton button(3, Pin, false, false, &queue);
+
+    drive(1000000, 0);
+    drive(1100000, 1);
+
+    HOST_CHECK_EQ(queue.edges.size(), 2u);
+
+    if (queue.edges.size() == 2)
+    {
+        HOST_CHECK(queue.edges[0].is_pressed());
+        HOST_CHECK_EQ(queue.edges[0].get_btn_id(), 3);
+        HOST_CHECK_EQ(queue.edges[0].get_time_us(), 1000000);
+        HOST_CHECK(!queue.edges[1].is_pressed());
+        HOST_CHECK_EQ(queue.edges[1].get_time_us(), 1100000);
+    }
+}
+
+// Each press and each release is one edge however much the contacts bounce
+static void test_bouncing_press()
+{
+    drive(0, 1);
+    RecordingQueue queue;
+    HwPushButton button(0, Pin, false, false, &queue);
+
+    bounce_to(1000000, 0, { 300, 800, 1500, 2000, 4000 });
+    bounce_to(1200000, 1, { 500, 1000, 19000 });
+
+    HOST_CHECK_EQ(queue.edges.size(), 2u);
+
+    if (queue.edges.size() == 2)
+    {
+        HOST_CHECK(queue.edges[0].is_pressed());
+        HOST_CHECK_EQ(queue.edges[0].get_time_us(), 1000000);
+        HOST_CHECK(!queue.edges[1].is_pressed());
+        HOST_CHECK_EQ(queue.edges[1].get_time_us(), 1200000);
+    }
+}
+
+// A release inside the bounce window of the press is lost, resync() picks it up from the pin
+static void test_lost_release()
+{
+    drive(0, 1);
+    RecordingQueue queue;
+    HwPushButton button(0, Pin, false, false, &queue);
+
+    drive(1000000, 0);
+    drive(1010000, 1);
+
+    HOST_CHECK_EQ(queue.edges.size(), 1u);
+    HOST_CHECK(!button.resync());
+
+    drive(1100000, 0);
+    HOST_CHECK_EQ(queue.edges.size(), 2u);
+    HOST_CHECK(queue.edges.back().is_pressed());
+}
+
+// Random bursts of bounce on many presses, the presses and releases alternate
+static void test_random_bounce()
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> toggles(0, 8);
+    std::uniform_int_distribution<int64_t> gap(50, 2000);
+    std::uniform_int_distribution<int64_t> hold_ms(30, 1000);
+
+    drive(0, 1);
+    RecordingQueue queue;
+    HwPushButton button(0, Pin, false, false, &queue);
+
+    int64_t time_us = 1000000;
+    constexpr int Presses = 500;
+
+    for (int press = 0; press < Presses; press++)
+    {
+        for (uint32_t level : { 0u, 1u })
+        {
+            // bounce ends well inside the 20 ms debounce window
+            std::vector<int64_t> bounce;
+            int64_t offset = 0;
+
+            for (int i = toggles(random); i > 0; i--)
+            {
+                offset += gap(random);
+                bounce.push_back(offset);
+            }
+
+            if (bounce.empty())
+            {
+                drive(time_us, level);
+            }
+            else
+            {
+                bounce_to(time_us, level, bounce);
+            }
+
+            time_us += hold_ms(random) * 1000;
+        }
+    }
+
+    HOST_CHECK_EQ(queue.edges.size(), 2u * Presses);
+
+    for (size_t i = 0; i < queue.edges.size(); i++)
+    {
+        HOST_CHECK_EQ(queue.edges[i].is_pressed(), i % 2 == 0);
+    }
+}
+
+int main()
+{
+    HostTest::run_test("clean press", test_clean_press);
+    HostTest::run_test("bouncing press", test_bouncing_press);
+    HostTest::run_test("lost release", test_lost_release);
+    HostTest::run_test("random bounce", test_random_bounce);
+    esp_timer_host_set_time(-1);
+    return HostTest::result();
+}
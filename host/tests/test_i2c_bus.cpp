@@ -0,0 +1,133 @@
+/****************************************************************************************
+ * test_i2c_bus.cpp - Host tests of the I2C bus clock speed and error tracking
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cstring>
+#include "model/DHT12Acquisition.h"
+#include "model/I2CBus.h"
+#include "HostTest.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+using Clock = DHT12Acquisition::Clock;
+
+// A DHT12 whose reads come back with a bad checksum when the SCL high period is too short
+// for its pull-ups or the data is not held long enough after SCL falls.  Every transfer is
+// acknowledged, only the checksum shows that the data is corrupt.
+struct SimulatedDHT12
+{
+    int min_high_period{ 0 };
+    int min_sda_hold_time{ 0 };
+    int reads{ 0 };
+    int corrupt_reads{ 0 };
+
+    static esp_err_t transfer(void* context, uint8_t address, i2c_rw_t rw, uint8_t* data, size_t length)
+    {
+        auto* dht12 = static_cast<SimulatedDHT12*>(context);
+
+        if (address != 0x5C)
+        {
+            return ESP_FAIL;
+        }
+
+        if (rw == I2C_MASTER_READ && length == 5)
+        {
+            // 45.0 %RH, 22.5 degC and the checksum
+            const uint8_t reading[5] = { 45, 0, 22, 5, 72 };
+            std::memcpy(data, reading, sizeof(reading));
+
+            i2c_host_timing_t timing = i2c_host_get_timing(I2C_NUM_0);
+            bool corrupt = timing.high_period < dht12->min_high_period
+                           || timing.sda_hold_time < dht12->min_sda_hold_time;
+
+            dht12->reads++;
+            dht12->corrupt_reads += corrupt ? 1 : 0;
+            data[3] ^= corrupt ? 0x01 : 0x00;
+        }
+
+        return ESP_OK;
+    }
+};
+
+// Every speed gets the data, start and stop timing i2c_param_config() would give it
+static void test_speed_timing()
+{
+    SimulatedDHT12 dht12;
+    i2c_host_set_device(I2C_NUM_0, SimulatedDHT12::transfer, &dht12);
+    I2CBus bus(I2C_NUM_0);
+
+    for (size_t fastest = 0; fastest < I2CBus::ClockSpeeds.size(); fastest++)
+    {
+        // the device only answers at the speed under test and slower
+        dht12.min_high_period = static_cast<int>(80 * 1000 * 1000 / I2CBus::ClockSpeeds[fastest] / 2);
+        uint32_t clock_hz = bus.probe_clock(0x5C, 0x00, 5, 3, DHT12Acquisition::is_valid);
+        HOST_CHECK_EQ(clock_hz, I2CBus::ClockSpeeds[fastest]);
+
+        i2c_host_timing_t timing = i2c_host_get_timing(I2C_NUM_0);
+        int half_period = static_cast<int>(80 * 1000 * 1000 / clock_hz / 2);
+        HOST_CHECK_EQ(timing.high_period, half_period);
+        HOST_CHECK_EQ(timing.low_period, half_period);
+        HOST_CHECK_EQ(timing.sda_sample_time, half_period / 2);
+        HOST_CHECK_EQ(timing.sda_hold_time, half_period / 2);
+        HOST_CHECK_EQ(timing.start_setup_time, half_period);
+        HOST_CHECK_EQ(timing.start_hold_time, half_period);
+        HOST_CHECK_EQ(timing.stop_setup_time, half_period);
+        HOST_CHECK_EQ(timing.stop_hold_time, half_period);
+    }
+
+    i2c_host_set_device(I2C_NUM_0, nullptr, nullptr);
+}
+
+// The transfers of a corrupted read succeed, the checksum failures alone step the clock
+// down and the slower clock, with its longer data hold time, reads good data again
+static void test_checksum_errors_step_down()
+{
+    SimulatedDHT12 dht12;
+    i2c_host_set_device(I2C_NUM_0, SimulatedDHT12::transfer, &dht12);
+    I2CBus bus(I2C_NUM_0);
+
+    // the probe only checks the transfers, as before the board warms up
+    HOST_CHECK_EQ(bus.probe_clock(0x5C, 0x00, 5, 3, nullptr), I2CBus::ClockSpeeds[0]);
+    dht12.min_sda_hold_time = 80 * 1000 * 1000 / I2CBus::ClockSpeeds[1] / 4;
+
+    DHT12Acquisition::Config config{};
+    config.max_attempts = 8;
+    config.first_backoff = milliseconds(100);
+    DHT12Acquisition acquisition(bus, config);
+
+    auto now = Clock::time_point{} + hours(1);
+    float temperature = 0.0f;
+    float humidity = 0.0f;
+    DHT12Acquisition::Status status = DHT12Acquisition::Status::Busy;
+    acquisition.start();
+
+    while (status == DHT12Acquisition::Status::Busy)
+    {
+        status = acquisition.poll(now, temperature, humidity);
+        now += milliseconds(100);
+    }
+
+    HOST_CHECK(status == DHT12Acquisition::Status::Completed);
+    HOST_CHECK_NEAR(temperature, 22.5, 0.01);
+    HOST_CHECK_EQ(bus.get_clock_hz(), I2CBus::ClockSpeeds[1]);
+
+    // the probe read 3 good values, then StepDownErrors bad checksums and one good read
+    HOST_CHECK_EQ(dht12.corrupt_reads, I2CBus::StepDownErrors);
+    HOST_CHECK_EQ(acquisition.get_checksum_error_count(), static_cast<uint32_t>(I2CBus::StepDownErrors));
+    HOST_CHECK_EQ(bus.get_speed_stats(0).errors, static_cast<uint32_t>(I2CBus::StepDownErrors));
+    HOST_CHECK_EQ(bus.get_speed_stats(1).errors, 0u);
+
+    i2c_host_set_device(I2C_NUM_0, nullptr, nullptr);
+}
+
+int main()
+{
+    HostTest::run_test("speed timing", test_speed_timing);
+    HostTest::run_test("checksum errors step down", test_checksum_errors_step_down);
+    return HostTest::result();
+}
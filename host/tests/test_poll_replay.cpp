@@ -0,0 +1,187 @@
+/****************************************************************************************
+ * test_poll_replay.cpp - Replays a simulated day through the poll policy and the record grid
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "model/AdaptivePollPolicy.h"
+#include "HostTest.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+using Clock = AdaptivePollPolicy::Clock;
+
+static constexpr int DaySeconds = 24 * 60 * 60;
+static constexpr seconds RecordInterval{ 30 };
+
+// A day of room climate: a diurnal swing, a fast temperature drop when a window is opened
+// at 10:00 and a shower-like humidity spike at 19:00
+struct Climate
+{
+    static float temperature(int t)
+    {
+        float value = 22.0f + 3.0f * sinf(static_cast<float>(t) * 6.2832f / DaySeconds);
+
+        // 4 degC down in 5 minutes and back within an hour
+        if (t >= 36000 && t < 36300)
+        {
+            value -= 4.0f * static_cast<float>(t - 36000) / 300.0f;
+        }
+        else if (t >= 36300 && t < 39900)
+        {
+            value -= 4.0f * static_cast<float>(39900 - t) / 3600.0f;
+        }
+
+        return value;
+    }
+
+    static float humidity(int t)
+    {
+        float value = 45.0f + 5.0f * sinf(static_cast<float>(t) * 6.2832f / DaySeconds + 1.0f);
+
+        // 30 %RH up in 10 minutes and back within 40 minutes
+        if (t >= 68400 && t < 69000)
+        {
+            value += 30.0f * static_cast<float>(t - 68400) / 600.0f;
+        }
+        else if (t >= 69000 && t < 71400)
+        {
+            value += 30.0f * static_cast<float>(71400 - t) / 2400.0f;
+        }
+
+        return value;
+    }
+};
+
+struct ReplayResult
+{
+    uint32_t reads{ 0 };
+    uint32_t publishes{ 0 };
+    float max_lag_c{ 0 };
+    std::vector<int> record_times{};
+    std::vector<int> publish_times{};
+};
+
+// The PollSensorTask tick, once a second: read when the period is due, publish outside the
+// deadband and record the latest reading on the 30 sec grid
+static ReplayResult replay(bool adaptive)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> noise(-1, 1);
+
+    AdaptivePollPolicy policy{ AdaptivePollPolicy::Config{} };
+    ReplayResult result{};
+    Clock::time_point start{};
+    Clock::time_point next_read = start;
+    Clock::time_point next_record = start + RecordInterval;
+    PackedSample latest{};
+    bool has_reading = false;
+
+    for (int t = 0; t < DaySeconds; t++)
+    {
+        auto now = start + seconds(t);
+
+        if (now >= next_read)
+        {
+            PackedSample sample = PackedSample::pack(Climate::temperature(t), Climate::humidity(t));
+            sample.temperature_deci_c = static_cast<int16_t>(sample.temperature_deci_c + noise(random));
+            sample.humidity_deci = static_cast<uint16_t>(sample.humidity_deci + noise(random));
+
+            auto interval = policy.next_interval(now, sample);
+            next_read = now + (adaptive ? interval : RecordInterval);
+            latest = sample;
+            has_reading = true;
+            result.reads++;
+
+            if (policy.should_publish(sample))
+            {
+                result.publishes++;
+                result.publish_times.push_back(t);
+            }
+        }
+
+        if (has_reading)
+        {
+            result.max_lag_c = std::max(result.max_lag_c,
+                                        std::fabs(latest.get_temperature_degree_C() - Climate::temperature(t)));
+        }
+
+        if (has_reading && now >= next_record)
+        {
+            result.record_times.push_back(t);
+            next_record = now - next_record > RecordInterval ? now + RecordInterval : next_record + RecordInterval;
+        }
+    }
+
+    return result;
+}
+
+// Count the events in the 64 minutes the 128 points of the trend chart cover
+static size_t count_in_trend_span(const std::vector<int>& times, int end)
+{
+    size_t count = 0;
+
+    for (int t : times)
+    {
+        count += t > end - 64 * 60 && t <= end ? 1 : 0;
+    }
+
+    return count;
+}
+
+static void test_adaptive_against_fixed()
+{
+    ReplayResult fixed = replay(false);
+    ReplayResult adaptive = replay(true);
+
+    std::cout << "fixed 30 s: " << fixed.reads << " reads, " << fixed.publishes << " publishes, "
+              << fixed.max_lag_c << " degC max lag" << std::endl;
+    std::cout << "adaptive:   " << adaptive.reads << " reads, " << adaptive.publishes << " publishes, "
+              << adaptive.max_lag_c << " degC max lag" << std::endl;
+
+    HOST_CHECK_EQ(fixed.reads, static_cast<uint32_t>(DaySeconds / 30));
+    HOST_CHECK(adaptive.reads * 3 < fixed.reads);
+    HOST_CHECK(adaptive.publishes * 10 < fixed.reads);
+
+    // the fast drop is seen at the next read, at most one maximum interval of 0.8 degC per
+    // minute after it starts, and followed at the minimum interval from then on
+    HOST_CHECK(adaptive.max_lag_c < 0.8f * 2.0f);
+}
+
+// The history, statistics, log and trend chart see one sample every 30 sec however often the
+// DHT12 is read and however few readings are published
+static void test_record_grid()
+{
+    ReplayResult adaptive = replay(true);
+
+    HOST_CHECK_EQ(adaptive.record_times.size(), static_cast<size_t>(DaySeconds / 30 - 1));
+
+    for (size_t i = 1; i < adaptive.record_times.size(); i++)
+    {
+        HOST_CHECK_EQ(adaptive.record_times[i] - adaptive.record_times[i - 1], 30);
+    }
+
+    // so the 128 points of the trend chart always span 64 minutes, the published values would not
+    for (int end : { 3 * 3600, 10 * 3600 + 600, 19 * 3600 + 600 })
+    {
+        HOST_CHECK_EQ(count_in_trend_span(adaptive.record_times, end), 128u);
+        std::cout << "publishes in the 64 minutes before " << end << " s: "
+                  << count_in_trend_span(adaptive.publish_times, end) << std::endl;
+    }
+
+    HOST_CHECK(count_in_trend_span(adaptive.publish_times, 3 * 3600) < 128u);
+}
+
+int main()
+{
+    HostTest::run_test("adaptive against fixed", test_adaptive_against_fixed);
+    HostTest::run_test("record grid", test_record_grid);
+    return HostTest::result();
+}
@@ -0,0 +1,127 @@
+/****************************************************************************************
+ * test_rolling_stats.cpp - Checks the rolling windows against a brute force window
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+#include "model/RollingStats.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+// Keeps every sample of the window and finds min, max and sum by looking at all of them
+template<size_t Slots, size_t SamplesPerSlot>
+class BruteForceWindow
+{
+    public:
+        void add(int16_t value)
+        {
+            open_slot.push_back(value);
+
+            if (open_slot.size() == SamplesPerSlot)
+            {
+                slots.push_back(open_slot);
+                open_slot.clear();
+
+                if (slots.size() > Slots)
+                {
+                    slots.pop_front();
+                }
+            }
+        }
+
+        RollingResult get() const
+        {
+            RollingResult result{ 0, 0, 0, 0 };
+            auto take = [&result](int16_t value)
+            {
+                result.min = result.count == 0 ? value : std::min(result.min, value);
+                result.max = result.count == 0 ? value : std::max(result.max, value);
+                result.sum += value;
+                result.count++;
+            };
+
+            for (const auto& slot : slots)
+            {
+                std::for_each(slot.begin(), slot.end(), take);
+            }
+
+            std::for_each(open_slot.begin(), open_slot.end(), take);
+            return result;
+        }
+
+    private:
+        std::deque<std::vector<int16_t>> slots{};
+        std::vector<int16_t> open_slot{};
+};
+
+// Feed both windows and compare them after every sample
+template<size_t Slots, size_t SamplesPerSlot, typename Source>
+static void compare(size_t samples, Source source)
+{
+    RollingWindow<Slots, SamplesPerSlot> window{};
+    BruteForceWindow<Slots, SamplesPerSlot> expected{};
+    size_t mismatches = 0;
+
+    for (size_t i = 0; i < samples; i++)
+    {
+        int16_t value = source(i);
+        window.add(value);
+        expected.add(value);
+
+        RollingResult a = window.get();
+        RollingResult b = expected.get();
+        bool same = a.min == b.min && a.max == b.max && a.sum == b.sum && a.count == b.count;
+        mismatches += same ? 0 : 1;
+    }
+
+    HOST_CHECK_EQ(mismatches, 0u);
+}
+
+// Rising and falling runs keep every slot in one of the deques, the deque is full
+static void test_monotonic()
+{
+    compare<120, 1>(1000, [](size_t i) { return static_cast<int16_t>(i); });
+    compare<120, 1>(1000, [](size_t i) { return static_cast<int16_t>(1000 - i); });
+    compare<288, 10>(10000, [](size_t i) { return static_cast<int16_t>(i / 3); });
+    compare<288, 10>(10000, [](size_t i) { return static_cast<int16_t>(-static_cast<int>(i / 3)); });
+    compare<4, 3>(200, [](size_t i) { return static_cast<int16_t>(i); });
+}
+
+// Equal values replace each other, the front must still expire with its slot
+static void test_constant()
+{
+    compare<120, 1>(1000, [](size_t) { return static_cast<int16_t>(215); });
+    compare<288, 10>(5000, [](size_t) { return static_cast<int16_t>(-40); });
+}
+
+static void test_random()
+{
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> temperature(-400, 800);
+    compare<120, 1>(5000, [&](size_t) { return static_cast<int16_t>(temperature(random)); });
+    compare<288, 10>(20000, [&](size_t) { return static_cast<int16_t>(temperature(random)); });
+    compare<7, 2>(2000, [&](size_t) { return static_cast<int16_t>(temperature(random)); });
+}
+
+// The 16 bit slot sequence wraps after 65536 slots, about 23 days of the 30 sec hour window
+static void test_sequence_wrap()
+{
+    compare<8, 1>(70000, [](size_t i) { return static_cast<int16_t>(i % 1000); });
+    compare<8, 1>(70000, [](size_t i) { return static_cast<int16_t>(1000 - i % 1000); });
+}
+
+int main()
+{
+    HostTest::run_test("monotonic", test_monotonic);
+    HostTest::run_test("constant", test_constant);
+    HostTest::run_test("random", test_random);
+    HostTest::run_test("sequence wrap", test_sequence_wrap);
+    return HostTest::result();
+}
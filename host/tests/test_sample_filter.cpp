@@ -0,0 +1,174 @@
+/****************************************************************************************
+ * test_sample_filter.cpp - Replays noisy DHT12 readings through the burst filter and the poll policy
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include "model/AdaptivePollPolicy.h"
+#include "model/SampleFilter.h"
+#include "HostTest.h"
+
+using namespace std::chrono;
+using namespace redstone;
+using namespace redstone::host;
+
+using Filter = SampleFilter<3, 2>;
+using Clock = AdaptivePollPolicy::Clock;
+
+// The DHT12 reads in bursts of 3 raw reads 2 sec apart
+static constexpr int BurstSpacing = 2;
+
+// The degF label shows one decimal
+static int to_label(const PackedSample& sample)
+{
+    return static_cast<int>(lroundf((sample.get_temperature_degree_C() * 1.8f + 32.0f) * 10.0f));
+}
+
+struct ChurnResult
+{
+    int label_changes{ 0 };
+    int spikes_shown{ 0 };
+    int publishes{ 0 };
+};
+
+// 6 hours of bursts every 30 sec at a constant 22 degC, with gaussian noise and 1 % of the
+// raw reads 5 degC too high
+static void replay_noise(ChurnResult& raw_result, ChurnResult& filtered_result)
+{
+    std::mt19937 random(17);
+    std::normal_distribution<float> noise(0.0f, 0.12f);
+    std::uniform_real_distribution<float> spike(0.0f, 1.0f);
+
+    Filter filter;
+    AdaptivePollPolicy raw_policy{ AdaptivePollPolicy::Config{} };
+    AdaptivePollPolicy filtered_policy{ AdaptivePollPolicy::Config{} };
+    int raw_label = 0;
+    int filtered_label = 0;
+
+    for (int burst = 0; burst < 6 * 60 * 2; burst++)
+    {
+        PackedSample raw{};
+
+        for (int i = 0; i < 3; i++)
+        {
+            float value = 22.0f + noise(random) + (spike(random) < 0.01f ? 5.0f : 0.0f);
+            raw = PackedSample::pack(value, 45.0f);
+            filter.add(raw);
+        }
+
+        PackedSample filtered = filter.decimate();
+
+        // the unfiltered firmware showed the last raw read of a poll
+        raw_result.label_changes += burst > 0 && to_label(raw) != raw_label ? 1 : 0;
+        filtered_result.label_changes += burst > 0 && to_label(filtered) != filtered_label ? 1 : 0;
+        raw_label = to_label(raw);
+        filtered_label = to_label(filtered);
+
+        raw_result.spikes_shown += raw.get_temperature_degree_C() > 24.0f ? 1 : 0;
+        filtered_result.spikes_shown += filtered.get_temperature_degree_C() > 24.0f ? 1 : 0;
+
+        raw_result.publishes += raw_policy.should_publish(raw) ? 1 : 0;
+        filtered_result.publishes += filtered_policy.should_publish(filtered) ? 1 : 0;
+    }
+}
+
+// Sensor noise and single bad reads do not reach the display or the publishes
+static void test_noise_churn()
+{
+    ChurnResult raw{};
+    ChurnResult filtered{};
+    replay_noise(raw, filtered);
+
+    std::cout << "raw:      " << raw.label_changes << " label changes, " << raw.spikes_shown << " spikes shown, "
+              << raw.publishes << " publishes" << std::endl;
+    std::cout << "filtered: " << filtered.label_changes << " label changes, " << filtered.spikes_shown
+              << " spikes shown, " << filtered.publishes << " publishes" << std::endl;
+
+    HOST_CHECK(filtered.label_changes * 3 < raw.label_changes);
+    HOST_CHECK(filtered.spikes_shown <= 1);
+    HOST_CHECK(raw.spikes_shown >= 10);
+    HOST_CHECK(filtered.publishes * 10 < raw.publishes);
+}
+
+struct RampResult
+{
+    float detected_after_s{ -1 };
+    int stable_reads_at_min{ 0 };
+};
+
+// An hour at 22 degC, then a ramp of rate_per_min for 10 minutes, read at the adaptive
+// interval with the poll policy fed the burst median or the EWMA output
+static RampResult replay_ramp(float rate_per_min, bool feed_median)
+{
+    std::mt19937 random(3);
+    std::normal_distribution<float> noise(0.0f, 0.12f);
+    auto truth = [rate_per_min](int t)
+    {
+        return t < 3600 ? 22.0f : 22.0f + rate_per_min * static_cast<float>(std::min(t - 3600, 600)) / 60.0f;
+    };
+
+    Filter filter;
+    AdaptivePollPolicy policy{ AdaptivePollPolicy::Config{} };
+    RampResult result{};
+    int t = 0;
+
+    while (t < 2 * 3600)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            filter.add(PackedSample::pack(truth(t + i * BurstSpacing) + noise(random), 45.0f));
+        }
+
+        PackedSample filtered = filter.decimate();
+        int done = t + 2 * BurstSpacing;
+        auto interval = policy.next_interval(Clock::time_point{} + seconds(done),
+                                             feed_median ? filter.get_last_median() : filtered);
+        bool at_min = interval == AdaptivePollPolicy::Config{}.min_interval;
+
+        result.stable_reads_at_min += done < 3600 && at_min ? 1 : 0;
+
+        if (t >= 3600 && at_min && result.detected_after_s < 0)
+        {
+            result.detected_after_s = static_cast<float>(done - 3600);
+        }
+
+        t += static_cast<int>(interval.count());
+    }
+
+    return result;
+}
+
+// The policy sees a ramp in the medians within about one maximum interval, through the
+// EWMA it sees a quarter of the rate and a 0.6 degC per minute ramp not at all
+static void test_rate_on_medians()
+{
+    for (float rate : { 0.6f, 1.0f, 2.0f })
+    {
+        RampResult median = replay_ramp(rate, true);
+        RampResult ewma = replay_ramp(rate, false);
+
+        std::cout << rate << " degC/min: median detected after " << median.detected_after_s << " s, ewma "
+                  << ewma.detected_after_s << " s" << std::endl;
+
+        HOST_CHECK(median.detected_after_s >= 0);
+        HOST_CHECK(median.detected_after_s <= 120 + 2 * (120 + 2 * BurstSpacing));
+        HOST_CHECK(ewma.detected_after_s < 0 || ewma.detected_after_s > median.detected_after_s);
+
+        // noise alone does not keep the interval at the minimum
+        HOST_CHECK_EQ(median.stable_reads_at_min, 0);
+    }
+
+    HOST_CHECK(replay_ramp(0.6f, false).detected_after_s < 0);
+}
+
+int main()
+{
+    HostTest::run_test("noise churn", test_noise_churn);
+    HostTest::run_test("rate on medians", test_rate_on_medians);
+    return HostTest::result();
+}
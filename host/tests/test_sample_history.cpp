@@ -0,0 +1,122 @@
+/****************************************************************************************
+ * test_sample_history.cpp - Checks the order of the samples in the sample history ring
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <memory>
+#include <vector>
+#include "model/SampleHistory.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+// The 24 hour history PollSensorTask keeps
+using History = SampleHistory<24 * 60 * 2>;
+
+static PackedSample sample_at(uint32_t i)
+{
+    return PackedSample{ static_cast<int16_t>(i % 30000), static_cast<uint16_t>(i / 30000) };
+}
+
+static uint32_t index_of(const PackedSample& sample)
+{
+    return static_cast<uint32_t>(sample.temperature_deci_c) + sample.humidity_deci * 30000u;
+}
+
+// Check that the history holds the samples first to last, oldest first
+static void check_order(const History& history, uint32_t first, uint32_t last)
+{
+    HOST_CHECK_EQ(history.size(), last - first + 1);
+    HOST_CHECK_EQ(index_of(history[0]), first);
+    HOST_CHECK_EQ(index_of(history.newest()), last);
+
+    std::vector<uint32_t> walked;
+
+    for (const auto& sample : history)
+    {
+        walked.push_back(index_of(sample));
+    }
+
+    bool in_order = walked.size() == history.size();
+
+    for (size_t i = 0; in_order && i < walked.size(); i++)
+    {
+        in_order = walked[i] == first + i && index_of(history[i]) == walked[i];
+    }
+
+    HOST_CHECK(in_order);
+}
+
+// Until the ring is full nothing is overwritten
+static void test_filling()
+{
+    auto history = std::make_unique<History>();
+    HOST_CHECK(history->empty());
+    HOST_CHECK(history->begin() == history->end());
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        history->append(sample_at(i));
+    }
+
+    check_order(*history, 0, 999);
+
+    for (uint32_t i = 1000; i < History::capacity(); i++)
+    {
+        history->append(sample_at(i));
+    }
+
+    check_order(*history, 0, History::capacity() - 1);
+}
+
+// Past the capacity the oldest samples are overwritten and the walk still starts at the oldest,
+// at every position of the ring head
+static void test_wraparound()
+{
+    auto history = std::make_unique<History>();
+    uint32_t appended = 0;
+
+    constexpr auto Capacity = static_cast<uint32_t>(History::capacity());
+
+    for (uint32_t step : { Capacity + 1, 499u, Capacity - 500, 1u, Capacity })
+    {
+        for (uint32_t i = 0; i < step; i++)
+        {
+            history->append(sample_at(appended++));
+        }
+
+        check_order(*history, appended - History::capacity(), appended - 1);
+    }
+
+    // over two full turns of the ring in total
+    HOST_CHECK(appended > 2 * History::capacity());
+}
+
+// A cleared history starts over at the first slot
+static void test_clear()
+{
+    auto history = std::make_unique<History>();
+
+    for (uint32_t i = 0; i < History::capacity() + 10; i++)
+    {
+        history->append(sample_at(i));
+    }
+
+    history->clear();
+    HOST_CHECK(history->empty());
+
+    history->append(sample_at(5000));
+    history->append(sample_at(5001));
+    check_order(*history, 5000, 5001);
+}
+
+int main()
+{
+    HostTest::run_test("filling", test_filling);
+    HostTest::run_test("wraparound", test_wraparound);
+    HostTest::run_test("clear", test_clear);
+    return HostTest::result();
+}
@@ -0,0 +1,324 @@
+/****************************************************************************************
+ * test_sample_log.cpp - Checks the sample log against files in a temporary directory
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "model/SampleLog.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+using Record = SampleLog::Record;
+
+// Two sectors per file so the tests reach the switch to the other file
+static constexpr size_t FileBytes = 2 * SampleLog::SectorSize;
+
+static std::string make_directory()
+{
+    char path[] = "sample_log_XXXXXX";
+    return mkdtemp(path) != nullptr ? path : "";
+}
+
+static void remove_directory(const std::string& directory)
+{
+    unlink((directory + "/samples0.log").c_str());
+    unlink((directory + "/samples1.log").c_str());
+    rmdir(directory.c_str());
+}
+
+static std::vector<Record> read_records(const std::string& directory, int index)
+{
+    std::vector<Record> records;
+    FILE* file = fopen((directory + (index == 0 ? "/samples0.log" : "/samples1.log")).c_str(), "rb");
+
+    if (file != nullptr)
+    {
+        Record record;
+
+        while (fread(&record, sizeof(record), 1, file) == 1)
+        {
+            records.push_back(record);
+        }
+
+        fclose(file);
+    }
+
+    return records;
+}
+
+static PackedSample sample_at(uint32_t i)
+{
+    return PackedSample{ static_cast<int16_t>(i % 1000), static_cast<uint16_t>(i % 1001) };
+}
+
+// Write a log file the way SampleLog leaves it, a file marker followed by whole sectors of
+// samples, or an empty file for no sectors
+static void write_log_file(const std::string& directory, int index, uint16_t sequence, size_t sectors)
+{
+    std::vector<Record> records(sectors * SampleLog::RecordsPerSector);
+
+    for (uint32_t i = 0; i < records.size(); i++)
+    {
+        records[i] = i == 0 ? Record{ SampleLog::FileMarker, PackedSample{ 0, sequence } } : Record{ i, sample_at(i) };
+    }
+
+    FILE* file = fopen((directory + (index == 0 ? "/samples0.log" : "/samples1.log")).c_str(), "wb");
+
+    if (file != nullptr)
+    {
+        fwrite(records.data(), sizeof(Record), records.size(), file);
+        fclose(file);
+    }
+}
+
+// Samples stay in RAM until the sector is full, then the whole sector is written at once
+static void test_sector_writes()
+{
+    std::string directory = make_directory();
+    SampleLog log(directory, FileBytes);
+    HOST_CHECK(log.open());
+
+    // the file and boot markers take the first two records of the sector
+    for (uint32_t i = 1; i < SampleLog::RecordsPerSector - 2; i++)
+    {
+        log.append(i * 30, sample_at(i));
+    }
+
+    HOST_CHECK_EQ(read_records(directory, 0).size(), 0u);
+    HOST_CHECK_EQ(log.get_erase_count(), 0u);
+
+    log.append(9999, sample_at(9999));
+
+    auto records = read_records(directory, 0);
+    HOST_CHECK_EQ(records.size(), SampleLog::RecordsPerSector);
+    HOST_CHECK_EQ(log.get_bytes_written(), SampleLog::SectorSize);
+    HOST_CHECK_EQ(log.get_erase_count(), 1u);
+    HOST_CHECK_EQ(log.get_write_errors(), 0u);
+
+    if (records.size() == SampleLog::RecordsPerSector)
+    {
+        HOST_CHECK_EQ(records[0].time_s, SampleLog::FileMarker);
+        HOST_CHECK_EQ(records[0].sample.humidity_deci, 0);
+        HOST_CHECK_EQ(records[1].time_s, SampleLog::BootMarker);
+        HOST_CHECK_EQ(records[2].time_s, 30u);
+        HOST_CHECK_EQ(records[2].sample.temperature_deci_c, 1);
+        HOST_CHECK_EQ(records.back().time_s, 9999u);
+        HOST_CHECK_EQ(records.back().sample.humidity_deci, 9999 % 1001);
+    }
+
+    remove_directory(directory);
+}
+
+// Each boot starts with a marker so the reader knows the uptime starts over
+static void test_boot_marker()
+{
+    std::string directory = make_directory();
+
+    for (int boot = 0; boot < 2; boot++)
+    {
+        SampleLog log(directory, FileBytes);
+        HOST_CHECK(log.open());
+        log.append(30, sample_at(1));
+        log.append(60, sample_at(2));
+        log.flush();
+    }
+
+    auto records = read_records(directory, 0);
+    HOST_CHECK_EQ(records.size(), 2 * SampleLog::RecordsPerSector);
+
+    if (records.size() == 2 * SampleLog::RecordsPerSector)
+    {
+        HOST_CHECK_EQ(records[0].time_s, SampleLog::FileMarker);
+
+        // only the first boot started the file
+        for (size_t sector = 0; sector < 2; sector++)
+        {
+            const Record* first = &records[sector * SampleLog::RecordsPerSector + (sector == 0 ? 1 : 0)];
+            HOST_CHECK_EQ(first[0].time_s, SampleLog::BootMarker);
+            HOST_CHECK_EQ(first[1].time_s, 30u);
+            HOST_CHECK_EQ(first[2].time_s, 60u);
+
+            // the rest of a flushed sector is padding
+            HOST_CHECK_EQ(first[3].time_s, SampleLog::PaddingTime);
+            HOST_CHECK_EQ(records[(sector + 1) * SampleLog::RecordsPerSector - 1].time_s, SampleLog::PaddingTime);
+        }
+    }
+
+    remove_directory(directory);
+}
+
+// When the current file is full the log goes on in the other file, the newest samples are kept
+static void test_file_switch()
+{
+    std::string directory = make_directory();
+    SampleLog log(directory, FileBytes);
+    HOST_CHECK(log.open());
+
+    uint32_t count = 5 * SampleLog::RecordsPerSector - 1;
+
+    for (uint32_t i = 1; i <= count; i++)
+    {
+        log.append(i, sample_at(i));
+    }
+
+    // sectors 1 and 2 filled file 0, sectors 3 and 4 file 1 and sector 5 started file 0 again,
+    // each file starts with a marker so the last 3 records are still buffered
+    auto file0 = read_records(directory, 0);
+    auto file1 = read_records(directory, 1);
+    HOST_CHECK_EQ(file0.size(), SampleLog::RecordsPerSector);
+    HOST_CHECK_EQ(file1.size(), 2 * SampleLog::RecordsPerSector);
+    HOST_CHECK_EQ(log.get_erase_count(), 5u);
+
+    if (file0.size() > 1 && file1.size() > 1)
+    {
+        HOST_CHECK_EQ(file1[0].time_s, SampleLog::FileMarker);
+        HOST_CHECK_EQ(file1[0].sample.humidity_deci, 1);
+        HOST_CHECK_EQ(file1[1].time_s, 2 * SampleLog::RecordsPerSector - 1);
+        HOST_CHECK_EQ(file0[0].time_s, SampleLog::FileMarker);
+        HOST_CHECK_EQ(file0[0].sample.humidity_deci, 2);
+        HOST_CHECK_EQ(file0.back().time_s, count - 3);
+    }
+
+    remove_directory(directory);
+}
+
+// A reopened log goes on in the file that is not full
+static void test_reopen()
+{
+    std::string directory = make_directory();
+
+    {
+        SampleLog log(directory, FileBytes);
+        HOST_CHECK(log.open());
+
+        for (uint32_t i = 1; i < 3 * SampleLog::RecordsPerSector; i++)
+        {
+            log.append(i, sample_at(i));
+        }
+    }
+
+    SampleLog log(directory, FileBytes);
+    HOST_CHECK(log.open());
+    log.flush();
+
+    HOST_CHECK_EQ(read_records(directory, 0).size(), 2 * SampleLog::RecordsPerSector);
+
+    auto file1 = read_records(directory, 1);
+    HOST_CHECK_EQ(file1.size(), 2 * SampleLog::RecordsPerSector);
+
+    if (file1.size() == 2 * SampleLog::RecordsPerSector)
+    {
+        HOST_CHECK_EQ(file1[0].time_s, SampleLog::FileMarker);
+        HOST_CHECK_EQ(file1[SampleLog::RecordsPerSector].time_s, SampleLog::BootMarker);
+    }
+
+    remove_directory(directory);
+}
+
+// A reboot right after file 0 filled up goes on in file 1 and keeps file 0
+static void test_reopen_full_file()
+{
+    for (bool file1_created : { false, true })
+    {
+        std::string directory = make_directory();
+        write_log_file(directory, 0, 7, 2);
+
+        if (file1_created)
+        {
+            write_log_file(directory, 1, 0, 0);
+        }
+
+        SampleLog log(directory, FileBytes);
+        HOST_CHECK(log.open());
+        log.flush();
+
+        auto file0 = read_records(directory, 0);
+        auto file1 = read_records(directory, 1);
+        HOST_CHECK_EQ(file0.size(), 2 * SampleLog::RecordsPerSector);
+        HOST_CHECK_EQ(file1.size(), SampleLog::RecordsPerSector);
+
+        if (file0.size() == 2 * SampleLog::RecordsPerSector && file1.size() == SampleLog::RecordsPerSector)
+        {
+            HOST_CHECK_EQ(file0[0].sample.humidity_deci, 7);
+            HOST_CHECK_EQ(file0.back().time_s, 2 * SampleLog::RecordsPerSector - 1);
+            HOST_CHECK_EQ(file1[0].time_s, SampleLog::FileMarker);
+            HOST_CHECK_EQ(file1[0].sample.humidity_deci, 8);
+            HOST_CHECK_EQ(file1[1].time_s, SampleLog::BootMarker);
+        }
+
+        remove_directory(directory);
+    }
+}
+
+// With both files full the reopened log truncates the older file, whichever index it has
+static void test_reopen_both_full()
+{
+    // file 0 is newer in the first case, the sequence numbers wrap around in the second
+    struct Case
+    {
+        uint16_t sequence0;
+        uint16_t sequence1;
+        int newest;
+    };
+
+    for (const Case& c : { Case{ 4, 3, 0 }, Case{ 0xFFFF, 0, 1 } })
+    {
+        std::string directory = make_directory();
+        write_log_file(directory, 0, c.sequence0, 2);
+        write_log_file(directory, 1, c.sequence1, 2);
+
+        SampleLog log(directory, FileBytes);
+        HOST_CHECK(log.open());
+        log.flush();
+
+        auto newest = read_records(directory, c.newest);
+        auto started = read_records(directory, 1 - c.newest);
+        HOST_CHECK_EQ(newest.size(), 2 * SampleLog::RecordsPerSector);
+        HOST_CHECK_EQ(started.size(), SampleLog::RecordsPerSector);
+
+        if (!newest.empty() && started.size() > 1)
+        {
+            uint16_t sequence = c.newest == 0 ? c.sequence0 : c.sequence1;
+            HOST_CHECK_EQ(newest[0].sample.humidity_deci, sequence);
+            HOST_CHECK_EQ(started[0].time_s, SampleLog::FileMarker);
+            HOST_CHECK_EQ(started[0].sample.humidity_deci, static_cast<uint16_t>(sequence + 1));
+            HOST_CHECK_EQ(started[1].time_s, SampleLog::BootMarker);
+        }
+
+        remove_directory(directory);
+    }
+}
+
+// A directory that does not exist is a failed open and every sector a write error
+static void test_missing_directory()
+{
+    SampleLog log("no_such_directory/sample_log", FileBytes);
+    HOST_CHECK(!log.open());
+
+    for (uint32_t i = 0; i < SampleLog::RecordsPerSector; i++)
+    {
+        log.append(i + 1, sample_at(i));
+    }
+
+    HOST_CHECK_EQ(log.get_write_errors(), 1u);
+    HOST_CHECK_EQ(log.get_bytes_written(), 0u);
+}
+
+int main()
+{
+    HostTest::run_test("sector writes", test_sector_writes);
+    HostTest::run_test("boot marker", test_boot_marker);
+    HostTest::run_test("file switch", test_file_switch);
+    HostTest::run_test("reopen", test_reopen);
+    HostTest::run_test("reopen full file", test_reopen_full_file);
+    HostTest::run_test("reopen both full", test_reopen_both_full);
+    HostTest::run_test("missing directory", test_missing_directory);
+    return HostTest::result();
+}
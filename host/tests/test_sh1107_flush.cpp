@@ -0,0 +1,197 @@
+/****************************************************************************************
+ * test_sh1107_flush.cpp - Checks the dirty column tracking and the SPI transfers of a flush
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <array>
+#include <cstring>
+#include <string>
+#include "fonts/ReadoutGlyphAtlas.h"
+#include "gui/SH1107FrameBuffer.h"
+#include "gui/SH1107PageFlush.h"
+#include "gui/SH1107Spi.h"
+#include "HostTest.h"
+#include "SH1107Sim.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+static constexpr int Columns = SH1107FrameBuffer::Columns;
+static constexpr int Pages = SH1107FrameBuffer::Pages;
+using Screen = std::array<uint8_t, Columns * Pages>;
+
+// The readout of a content pane, in the rows (columns in page layout) below the title pane
+static constexpr int ReadoutColumn = 22;
+
+// Draw text from the readout glyph atlas into a screen in page layout, left aligned
+static void draw_text(Screen& screen, const std::string& text)
+{
+    for (size_t c = 0; c < text.size(); c++)
+    {
+        size_t glyph = 0;
+
+        for (size_t g = 0; g < ReadoutGlyphAtlas::codes.size(); g++)
+        {
+            glyph = ReadoutGlyphAtlas::codes[g] == static_cast<char32_t>(text[c]) ? g : glyph;
+        }
+
+        for (int cell_page = 0; cell_page < ReadoutGlyphAtlas::CellPages; cell_page++)
+        {
+            int page = static_cast<int>(c) * ReadoutGlyphAtlas::CellPages + cell_page;
+            const uint8_t* cell = &ReadoutGlyphAtlas::cells[glyph * ReadoutGlyphAtlas::CellSize
+                                                            + cell_page * ReadoutGlyphAtlas::CellColumns];
+            std::memcpy(&screen[page * Columns + ReadoutColumn], cell, ReadoutGlyphAtlas::CellColumns);
+        }
+    }
+}
+
+// Count the pages that have a lit pixel
+static uint32_t lit_pages(const Screen& screen)
+{
+    uint32_t count = 0;
+
+    for (int page = 0; page < Pages; page++)
+    {
+        bool lit = false;
+
+        for (int column = 0; column < Columns; column++)
+        {
+            lit |= screen[page * Columns + column] != 0;
+        }
+
+        count += lit ? 1 : 0;
+    }
+
+    return count;
+}
+
+// Only the span from the first to the last changed column of a page is dirty
+static void test_update_page()
+{
+    SH1107FrameBuffer frame_buffer{};
+    std::array<uint8_t, Columns> page{};
+    int first_dirty;
+    size_t length;
+
+    HOST_CHECK(!frame_buffer.update_page(3, 0, Columns - 1, page.data(), first_dirty, length));
+    HOST_CHECK_EQ(length, 0u);
+
+    page[10] = 0x81;
+    HOST_CHECK(frame_buffer.update_page(3, 0, Columns - 1, page.data(), first_dirty, length));
+    HOST_CHECK_EQ(first_dirty, 10);
+    HOST_CHECK_EQ(length, 1u);
+    HOST_CHECK(frame_buffer.get_pixel(10, 3 * 8) && frame_buffer.get_pixel(10, 3 * 8 + 7));
+
+    // the same data again is clean
+    HOST_CHECK(!frame_buffer.update_page(3, 0, Columns - 1, page.data(), first_dirty, length));
+
+    page[12] = 0x01;
+    page[40] = 0x02;
+    HOST_CHECK(frame_buffer.update_page(3, 0, Columns - 1, page.data(), first_dirty, length));
+    HOST_CHECK_EQ(first_dirty, 12);
+    HOST_CHECK_EQ(length, 29u);
+
+    // a partial area, data starts at start_col
+    std::array<uint8_t, 8> part{};
+    part[5] = 0xFF;
+    HOST_CHECK(frame_buffer.update_page(7, 20, 27, part.data(), first_dirty, length));
+    HOST_CHECK_EQ(first_dirty, 25);
+    HOST_CHECK_EQ(length, 1u);
+    HOST_CHECK_EQ(frame_buffer.data()[7 * Columns + 25], 0xFF);
+    HOST_CHECK_EQ(frame_buffer.data()[7 * Columns + 24], 0x00);
+}
+
+// The transfers of a flush through SH1107Spi land where they belong in the display ram,
+// and each dirty page costs one command and one data transaction
+static void test_flush_transactions()
+{
+    SH1107Spi spi(GPIO_NUM_14, GPIO_NUM_27, GPIO_NUM_33, SPI_MASTER_FREQ_8M);
+    SH1107Sim display(GPIO_NUM_27);
+    display.attach(VSPI_HOST);
+    HOST_CHECK(spi.initialize(VSPI_HOST));
+
+    std::array<uint8_t, SH1107PageFlush<SH1107Spi>::CmdBufferLen> page_commands{};
+    SH1107PageFlush<SH1107Spi> page_flush(spi, page_commands.data());
+
+    Screen screen{};
+    HOST_CHECK(page_flush.prepare_clear(screen.data()));
+    HOST_CHECK(spi.submit(false));
+    HOST_CHECK(spi.collect_results());
+    HOST_CHECK_EQ(display.get_counters().transactions, 2u * Pages);
+
+    // a full screen flush of "72.5F"
+    draw_text(screen, "72.5F");
+    display.reset_counters();
+    HOST_CHECK(page_flush.prepare_area(0, Pages - 1, 0, Columns - 1, screen.data()));
+    HOST_CHECK(spi.submit(true));
+    HOST_CHECK(spi.collect_results());
+    HOST_CHECK(display.shows(page_flush.get_frame_buffer()));
+    HOST_CHECK_EQ(display.get_counters().transactions, 2u * lit_pages(screen));
+    HOST_CHECK(display.get_counters().data_bytes <= 5u * ReadoutGlyphAtlas::CellSize);
+
+    // a decimal point that goes away changes one page only, one command and one data transaction
+    draw_text(screen, "72 5F");
+    display.reset_counters();
+    HOST_CHECK(page_flush.prepare_area(0, Pages - 1, 0, Columns - 1, screen.data()));
+    HOST_CHECK(spi.submit(true));
+    HOST_CHECK(spi.collect_results());
+    HOST_CHECK(display.shows(page_flush.get_frame_buffer()));
+    HOST_CHECK_EQ(display.get_counters().command_transactions, 1u);
+    HOST_CHECK_EQ(display.get_counters().data_transactions, 1u);
+    HOST_CHECK(display.get_counters().data_bytes <= static_cast<uint32_t>(ReadoutGlyphAtlas::CellColumns));
+
+    // a digit is two pages wide, changing one is a command and a data transaction per page
+    draw_text(screen, "72 6F");
+    display.reset_counters();
+    HOST_CHECK(page_flush.prepare_area(0, Pages - 1, 0, Columns - 1, screen.data()));
+    HOST_CHECK(spi.submit(true));
+    HOST_CHECK(spi.collect_results());
+    HOST_CHECK(display.shows(page_flush.get_frame_buffer()));
+    HOST_CHECK_EQ(display.get_counters().transactions, 2u * ReadoutGlyphAtlas::CellPages);
+
+    // the same screen again sends nothing
+    display.reset_counters();
+    HOST_CHECK(page_flush.prepare_area(0, Pages - 1, 0, Columns - 1, screen.data()));
+    HOST_CHECK(!spi.submit(true));
+    HOST_CHECK_EQ(display.get_counters().transactions, 0u);
+    HOST_CHECK_EQ(spi.get_error_count(), 0u);
+}
+
+// A flush of half the screen, the way LittlevGL hands over the two halves of a full redraw
+static void test_flush_half_screen()
+{
+    SH1107Spi spi(GPIO_NUM_14, GPIO_NUM_27, GPIO_NUM_33, SPI_MASTER_FREQ_8M);
+    SH1107Sim display(GPIO_NUM_27);
+    display.attach(VSPI_HOST);
+    HOST_CHECK(spi.initialize(VSPI_HOST));
+
+    std::array<uint8_t, SH1107PageFlush<SH1107Spi>::CmdBufferLen> page_commands{};
+    SH1107PageFlush<SH1107Spi> page_flush(spi, page_commands.data());
+    Screen blank{};
+    page_flush.prepare_clear(blank.data());
+    spi.submit(false);
+    spi.collect_results();
+
+    // rows 32 to 63 of every page, the buffer has the stride of a full page
+    Screen half{};
+    half.fill(0x5A);
+    display.reset_counters();
+    HOST_CHECK(page_flush.prepare_area(0, Pages - 1, 32, 63, half.data()));
+    HOST_CHECK(spi.submit(true));
+    HOST_CHECK(spi.collect_results());
+    HOST_CHECK(display.shows(page_flush.get_frame_buffer()));
+    HOST_CHECK_EQ(display.get_counters().data_bytes, 32u * Pages);
+    HOST_CHECK_EQ(display.get_ram(0, 31), 0x00);
+    HOST_CHECK_EQ(display.get_ram(0, 32), 0x5A);
+    HOST_CHECK_EQ(display.get_ram(15, 63), 0x5A);
+}
+
+int main()
+{
+    HostTest::run_test("update_page", test_update_page);
+    HostTest::run_test("flush transactions", test_flush_transactions);
+    HostTest::run_test("flush half screen", test_flush_half_screen);
+    return HostTest::result();
+}
@@ -0,0 +1,71 @@
+/****************************************************************************************
+ * test_trace_ring.cpp - Host tests of the trace ring timestamps and dump
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "stats/TraceRing.h"
+#include "HostTest.h"
+
+using namespace redstone;
+using namespace redstone::host;
+
+// Record an event at a given esp_timer time
+static void record_at(int64_t time_us, TraceEventType type, uint16_t arg)
+{
+    esp_timer_host_set_time(time_us);
+    TraceRing::record(type, arg);
+}
+
+// Events further apart than the 17.9 sec wrap of a 240 MHz cycle counter, and across a wrap
+// of the 32 bit microsecond timestamp, keep their order and spacing in the dump
+static void test_dump_timestamps()
+{
+    const int64_t start_us = (int64_t{ 1 } << 32) - 5 * 1000 * 1000;
+    const int64_t times_us[] = { start_us, start_us + 30 * 1000 * 1000, start_us + 30 * 1000 * 1000 + 250,
+                                 start_us + 10 * 60 * 1000 * 1000 };
+
+    record_at(times_us[0], TraceEventType::SampleRead, 0);
+    record_at(times_us[1], TraceEventType::ButtonEdge, 0x100);
+    record_at(times_us[2], TraceEventType::FlushDone, 0);
+    record_at(times_us[3], TraceEventType::SampleRead, 0);
+
+    esp_timer_host_set_time(times_us[3] + 1000);
+    std::vector<uint8_t> blob(TraceRing::MaxDumpSize);
+    size_t size = TraceRing::dump(blob.data(), blob.size());
+    esp_timer_host_set_time(-1);
+
+    HOST_CHECK_EQ(size, sizeof(TraceRing::Header) + 4 * sizeof(TraceRing::Event));
+
+    TraceRing::Header header{};
+    std::memcpy(&header, blob.data(), sizeof(header));
+    HOST_CHECK_EQ(header.magic, TraceRing::Magic);
+    HOST_CHECK_EQ(header.version, TraceRing::Version);
+    HOST_CHECK_EQ(header.event_count, 4);
+    HOST_CHECK_EQ(header.time_us, times_us[3] + 1000);
+
+    // unwrap back from the dump time as tools/decode_trace.py does
+    int64_t previous_us = header.time_us;
+
+    for (int i = 3; i >= 0; i--)
+    {
+        TraceRing::Event event{};
+        std::memcpy(&event, blob.data() + sizeof(header) + i * sizeof(event), sizeof(event));
+        previous_us -= static_cast<int32_t>(static_cast<uint32_t>(previous_us) - event.time_us);
+        HOST_CHECK_EQ(previous_us, times_us[i]);
+    }
+
+    // the dump for the decoder
+    std::ofstream("trace.bin", std::ios::binary).write(reinterpret_cast<const char*>(blob.data()),
+                                                       static_cast<std::streamsize>(size));
+}
+
+int main()
+{
+    HostTest::run_test("dump timestamps", test_dump_timestamps);
+    return HostTest::result();
+}
@@ -39,6 +39,10 @@
 #include <smooth/core/task_priorities.h>
 #include <smooth/core/logging/log.h>
 #include <smooth/core/SystemStatistics.h>
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
+#include <algorithm>
+#include <memory>
 
 using namespace smooth::core;
 using namespace std::chrono;
@@ -49,7 +53,8 @@ namespace redstone
     static const char* TAG = "APP";
 
     // Constructor                                     
-    App::App() : Application(APPLICATION_BASE_PRIO, seconds(60))
+    App::App() : Application(APPLICATION_BASE_PRIO, seconds(60)),
+            subr_queue_trace_dump(SubQTraceDump::create(1, *this, *this))
     {
     }
 
@@ -59,6 +64,7 @@ namespace redstone
         Log::warning(TAG, "============ Starting APP  ===========");
         Application::init();
         lvgl_task.start();
+        sample_log_task.start();
         poll_sensor_task.start();
     }
 
@@ -73,5 +79,82 @@ namespace redstone
         }
 
         SystemStatistics::instance().dump();
+        TimingStats::instance().dump_and_reset();
+
+        Log::info(TAG, "LvglTask wakeups per minute: {}", lvgl_task.get_wakeups_per_minute());
+
+        const auto& acquisition = poll_sensor_task.get_acquisition();
+        Log::info(TAG, "DHT12: {} completed, {} failed, {} retries, {} nacks, {} timeouts, {} checksum errors",
+                  acquisition.get_completed_count(), acquisition.get_failed_count(), acquisition.get_retry_count(),
+                  acquisition.get_nack_count(), acquisition.get_timeout_count(),
+                  acquisition.get_checksum_error_count());
+
+        const auto& bus_scheduler = poll_sensor_task.get_bus_scheduler();
+        Log::info(TAG, "I2C bus: {} sensors, {} sessions and {} us busy per minute, {} readings, {} failures",
+                  bus_scheduler.get_sensor_count(), bus_scheduler.get_sessions_per_minute(),
+                  bus_scheduler.get_bus_busy_us_per_minute(), bus_scheduler.get_reading_count(),
+                  bus_scheduler.get_failure_count());
+
+        const auto& i2c_bus = poll_sensor_task.get_i2c_bus();
+
+        for (size_t i = 0; i < I2CBus::ClockSpeeds.size(); i++)
+        {
+            auto stats = i2c_bus.get_speed_stats(i);
+            uint32_t succeeded = stats.transfers - stats.errors;
+
+            if (stats.transfers > 0)
+            {
+                Log::info(TAG, "I2C {} kHz{}: {} transfers, {} errors, {} us average, {} us max",
+                          I2CBus::ClockSpeeds[i] / 1000, i2c_bus.get_clock_hz() == I2CBus::ClockSpeeds[i] ? " (current)" : "",
+                          stats.transfers, stats.errors, succeeded > 0 ? stats.total_us / succeeded : 0, stats.max_us);
+            }
+        }
+
+        const auto& poll_policy = poll_sensor_task.get_poll_policy();
+        Log::info(TAG, "Poll policy: interval {} sec, {} reads, {} publishes, {} suppressed by deadband",
+                  poll_policy.get_interval().count(), poll_policy.get_read_count(),
+                  poll_policy.get_publish_count(), poll_policy.get_suppressed_count());
+
+        if (auto sample_log = sample_log_task.get_sample_log())
+        {
+            Log::info(TAG, "Sample log: {} bytes written, {} erases, {} us stalled ({} us max), {} errors",
+                      sample_log->get_bytes_written(), sample_log->get_erase_count(),
+                      sample_log->get_write_stall_us(), sample_log->get_max_write_stall_us(),
+                      sample_log->get_write_errors());
+        }
+    }
+
+    // A trace dump was asked for, log it now instead of at the next tick
+    void App::event(const TraceDumpRequest& /*event*/)
+    {
+        dump_trace();
+    }
+
+    // Log the trace ring as hex lines, tools/decode_trace.py turns the log into a Chrome trace
+    void App::dump_trace()
+    {
+        static constexpr size_t BytesPerLine = 32;
+        static const char* Hex = "0123456789abcdef";
+
+        auto blob = std::make_unique<uint8_t[]>(TraceRing::MaxDumpSize);
+        size_t size = TraceRing::dump(blob.get(), TraceRing::MaxDumpSize);
+
+        Log::info(TAG, "TRACE BEGIN {}", size);
+
+        for (size_t offset = 0; offset < size; offset += BytesPerLine)
+        {
+            char line[BytesPerLine * 2 + 1]{};
+            size_t length = std::min(BytesPerLine, size - offset);
+
+            for (size_t i = 0; i < length; i++)
+            {
+                line[i * 2] = Hex[blob[offset + i] >> 4];
+                line[i * 2 + 1] = Hex[blob[offset + i] & 0x0F];
+            }
+
+            Log::info(TAG, "TRACE {}", line);
+        }
+
+        Log::info(TAG, "TRACE END");
     }
 }
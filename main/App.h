@@ -16,13 +16,18 @@
  ***************************************************************************************/
 #pragma once
 
+#include <memory>
 #include <smooth/core/Application.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
 #include "gui/LvglTask.h"
 #include "model/PollSensorTask.h"
+#include "model/SampleLogTask.h"
+#include "stats/TraceRing.h"
 
 namespace redstone
 {
-    class App : public smooth::core::Application
+    class App : public smooth::core::Application, public smooth::core::ipc::IEventListener<TraceDumpRequest>
     {
         public:
             App();
@@ -31,8 +36,17 @@ namespace redstone
 
             void tick() override;
 
+            /// The event that a trace dump was asked for, e.g. by a long button press
+            void event(const TraceDumpRequest& event) override;
+
         private:
+            void dump_trace();
+
+            using SubQTraceDump = smooth::core::ipc::SubscribingTaskEventQueue<TraceDumpRequest>;
+            std::shared_ptr<SubQTraceDump> subr_queue_trace_dump;
+
             LvglTask lvgl_task{};
             PollSensorTask poll_sensor_task{};
+            SampleLogTask sample_log_task{};
     };
 }
@@ -12,12 +12,20 @@ set(SOURCES
 
         gui/DisplayDriver.cpp
         gui/DisplayDriver.h
+        gui/SH1107FrameBuffer.h
+        gui/SH1107PageFlush.h
+        gui/SH1107Spi.cpp
+        gui/SH1107Spi.h
 
         gui/GuiButton.cpp
         gui/GuiButton.h
         gui/GuiButtonNext.cpp
         gui/GuiButtonNext.h
+        gui/GuiReadout.cpp
+        gui/GuiReadout.h
+        gui/HwPushButton.cpp
         gui/HwPushButton.h
+        gui/HwButtonEdge.h
 
         gui/TitlePane.cpp
         gui/TitlePane.h
@@ -26,6 +34,8 @@ set(SOURCES
         gui/MenuPane.h
 
         gui/IPane.h
+        gui/IContentPane.h
+        gui/FixedPointText.h
         gui/CPTemperature.cpp
         gui/CPTemperature.h
         gui/CPHumidity.cpp
@@ -34,11 +44,41 @@ set(SOURCES
         gui/CPHeatIndex.h
         gui/CPDewPoint.cpp
         gui/CPDewPoint.h
+        gui/CPTrend.cpp
+        gui/CPTrend.h
 
         model/PollSensorTask.cpp
         model/PollSensorTask.h
         model/EnvirValue.h
+        model/EnvirFormulas.h
+        model/EnvirLookupTable.h
+        model/EnvirStats.h
+        model/SampleHistory.h
+        model/SampleLog.cpp
+        model/SampleLog.h
+        model/SampleLogTask.cpp
+        model/SampleLogTask.h
+        model/RollingStats.h
+        model/II2CBus.h
+        model/I2CBus.cpp
+        model/I2CBus.h
+        model/DHT12Acquisition.cpp
+        model/DHT12Acquisition.h
+        model/AdaptivePollPolicy.h
+        model/SampleFilter.h
+        model/MultiChannelSample.h
+        model/ISensor.h
+        model/BusScheduler.h
+        model/DHT12Sensor.cpp
+        model/DHT12Sensor.h
+
+        stats/TimingHistogram.h
+        stats/TimingStats.cpp
+        stats/TimingStats.h
+        stats/TraceRing.cpp
+        stats/TraceRing.h
 
         fonts/lv_font_14x14B_latin1_sup.c
+        fonts/ReadoutGlyphAtlas.h
         )
 
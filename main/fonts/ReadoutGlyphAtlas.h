@@ -0,0 +1,115 @@
+/****************************************************************************************
+ * ReadoutGlyphAtlas.h - The readout glyphs of lv_font_14x14B_latin1_sup in SH1107 page layout
+ *
+ * Generated by tools/gen_glyph_atlas.py from lv_font_14x14B_latin1_sup.c, do not edit
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace redstone
+{
+    // A cell is CellPages pages of CellColumns columns, stored page after page.  Bit b of a
+    // byte is the pixel at x = page * 8 + b of the cell (landscape), 1 is lit.
+    struct ReadoutGlyphAtlas
+    {
+        static constexpr int CellWidth = 16;
+        static constexpr int CellPages = 2;
+        static constexpr int CellColumns = 14;
+        static constexpr int CellSize = CellPages * CellColumns;
+        static constexpr int GlyphCount = 19;
+
+        // The character of each cell, cell 0 is blank
+        static constexpr std::array<char32_t, GlyphCount> codes{
+            U'\u0020',    // space
+            U'\u002d',    // -
+            U'\u002e',    // .
+            U'\u0030',    // 0
+            U'\u0031',    // 1
+            U'\u0032',    // 2
+            U'\u0033',    // 3
+            U'\u0034',    // 4
+            U'\u0035',    // 5
+            U'\u0036',    // 6
+            U'\u0037',    // 7
+            U'\u0038',    // 8
+            U'\u0039',    // 9
+            U'\u0025',    // %
+            U'\u00b0',    // °
+            U'\u0043',    // C
+            U'\u0046',    // F
+            U'\u0048',    // H
+            U'\u0052',    // R
+        };
+
+        static constexpr std::array<uint8_t, GlyphCount * CellSize> cells{
+            // ' '
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // '-'
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // '.'
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // '0'
+            0x00, 0xf0, 0xf8, 0x1c, 0x0e, 0xce, 0xce, 0x0e, 0x1c, 0xf8, 0xf0, 0x00, 0x00, 0x00,
+            0x00, 0x03, 0x07, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x07, 0x03, 0x00, 0x00, 0x00,
+            // '1'
+            0x00, 0xf0, 0xf8, 0xfc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xfe, 0xfe, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00,
+            // '2'
+            0x00, 0xf8, 0xfc, 0x0e, 0x00, 0x00, 0x80, 0xe0, 0x78, 0xfc, 0xfe, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x1c, 0x0e, 0x07, 0x01, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+            // '3'
+            0x00, 0xf8, 0xfc, 0x0e, 0x00, 0xc0, 0xc0, 0x00, 0x0e, 0xfc, 0xf8, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x0e, 0x07, 0x07, 0x0e, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // '4'
+            0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0e, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+            // '5'
+            0x00, 0xfe, 0xfe, 0x0e, 0x0e, 0xfe, 0xfe, 0x00, 0x06, 0xfe, 0xfc, 0x00, 0x00, 0x00,
+            0x00, 0x0f, 0x0f, 0x00, 0x00, 0x07, 0x0f, 0x1c, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // '6'
+            0x00, 0xf8, 0xfc, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0xfc, 0xf8, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x0c, 0x00, 0x07, 0x0f, 0x1c, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // '7'
+            0x00, 0xfc, 0xfc, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x00, 0x00, 0x00,
+            0x00, 0x1f, 0x1f, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // '8'
+            0x00, 0xf8, 0xfc, 0x0e, 0x1c, 0xf8, 0xfc, 0x0e, 0x0e, 0xfc, 0xf8, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x0e, 0x07, 0x0f, 0x1c, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // '9'
+            0x00, 0xf8, 0xfc, 0x0e, 0x1c, 0xf8, 0xf0, 0x00, 0x1c, 0xfc, 0xf8, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x18, 0x1f, 0x1f, 0x1c, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // '%'
+            0x00, 0x0c, 0x1e, 0x1e, 0x8c, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x00, 0x00, 0x00,
+            0x00, 0x1c, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00, 0x00,
+            // '°'
+            0xc0, 0xe0, 0x30, 0x30, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // 'C'
+            0x00, 0xf0, 0xf8, 0x1c, 0x0e, 0x0e, 0x0e, 0x0e, 0x1c, 0xf8, 0xf0, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00,
+            // 'F'
+            0x00, 0xfe, 0xfe, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+            0x00, 0x1f, 0x1f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            // 'H'
+            0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+            0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00,
+            // 'R'
+            0x00, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+            0x00, 0x07, 0x0f, 0x1c, 0x1c, 0x0e, 0x07, 0x03, 0x07, 0x0e, 0x1c, 0x00, 0x00, 0x00,
+        };
+    };
+}
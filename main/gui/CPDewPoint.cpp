@@ -14,8 +14,6 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
-#include <sstream>
-#include <iomanip>  // for set precision
 #include "gui/CPDewPoint.h"
 
 #include <smooth/core/logging/log.h>
@@ -27,14 +25,7 @@ namespace redstone
     static const char* TAG = "CPDewPoint";
 
     // Constructor
-    CPDewPoint::CPDewPoint(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
-
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+    CPDewPoint::CPDewPoint()
     {
     }
 
@@ -67,34 +58,30 @@ namespace redstone
         lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
         lv_obj_set_hidden(content_container, true);
 
-        // create style for dew_point value
-        lv_style_init(&dew_point_label_style);
-        lv_style_set_text_color(&dew_point_label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
-        lv_style_set_text_font(&dew_point_label_style, LV_STATE_DEFAULT, &lv_font_14x14B_latin1_sup);
-
-        // create a dynamic label for dew point measurement value
-        dew_point_value_label = lv_label_create(content_container, NULL);
-        lv_obj_add_style(dew_point_value_label, LV_LABEL_PART_MAIN, &dew_point_label_style);
-        lv_label_set_text(dew_point_value_label, "--");
-        lv_obj_align(dew_point_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        // create a readout for dew point measurement value, it draws the glyphs of
+        // lv_font_14x14B_latin1_sup from a prerendered atlas
+        dew_point_readout.create(content_container);
+        dew_point_readout.set_text("--");
+        lv_obj_align(dew_point_readout.get_obj(), NULL, LV_ALIGN_CENTER, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPDewPoint::event(const EnvirValue& event)
+    // Update the dew point readout, the readout is only redrawn when its text changes
+    bool CPDewPoint::update_value(const EnvirValue& value)
     {
-        dew_point = event.get_dew_point_fahrenheit();
-        update_dew_point_text();
-    }
+        dew_point = value.get_dew_point_fahrenheit();
 
-    // Update the dew point value label
-    void CPDewPoint::update_dew_point_text()
-    {
-        std::ostringstream stream;
+        FixedPointText<16> new_text{};
+        new_text.format(dew_point, 1, "\u00b0F");
+
+        if (new_text == dew_point_text)
+        {
+            return false;
+        }
+
+        dew_point_text = new_text;
+        dew_point_readout.set_text(dew_point_text.c_str());
 
-        stream << std::fixed << std::setprecision(1) << dew_point;
-        std::string dew_point_text = stream.str() + "\u00b0" + "F";
-        lv_label_set_text(dew_point_value_label, dew_point_text.c_str());
-        lv_obj_align(dew_point_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        return true;
     }
 
     // Show the content pane
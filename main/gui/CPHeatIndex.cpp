@@ -14,8 +14,6 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
-#include <sstream>
-#include <iomanip>  // for set precision
 #include "gui/CPHeatIndex.h"
 
 #include <smooth/core/logging/log.h>
@@ -27,14 +25,7 @@ namespace redstone
     static const char* TAG = "CPHeatIndex";
 
     // Constructor
-    CPHeatIndex::CPHeatIndex(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
-
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+    CPHeatIndex::CPHeatIndex()
     {
     }
 
@@ -67,34 +58,30 @@ namespace redstone
         lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
         lv_obj_set_hidden(content_container, true);
 
-        // create style for heat_index value
-        lv_style_init(&heat_index_label_style);
-        lv_style_set_text_color(&heat_index_label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
-        lv_style_set_text_font(&heat_index_label_style, LV_STATE_DEFAULT, &lv_font_14x14B_latin1_sup);
-
-        // create a dynamic label for heat index measurement value
-        heat_index_value_label = lv_label_create(content_container, NULL);
-        lv_obj_add_style(heat_index_value_label, LV_LABEL_PART_MAIN, &heat_index_label_style);
-        lv_label_set_text(heat_index_value_label, "--");
-        lv_obj_align(heat_index_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        // create a readout for heat index measurement value, it draws the glyphs of
+        // lv_font_14x14B_latin1_sup from a prerendered atlas
+        heat_index_readout.create(content_container);
+        heat_index_readout.set_text("--");
+        lv_obj_align(heat_index_readout.get_obj(), NULL, LV_ALIGN_CENTER, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPHeatIndex::event(const EnvirValue& event)
+    // Update the heat index readout, the readout is only redrawn when its text changes
+    bool CPHeatIndex::update_value(const EnvirValue& value)
     {
-        heat_index = event.get_heat_index_fahrenheit();
-        update_heat_index_text();
-    }
+        heat_index = value.get_heat_index_fahrenheit();
 
-    // Update the heat index value label
-    void CPHeatIndex::update_heat_index_text()
-    {
-        std::ostringstream stream;
+        FixedPointText<16> new_text{};
+        new_text.format(heat_index, 1, "\u00b0F");
+
+        if (new_text == heat_index_text)
+        {
+            return false;
+        }
+
+        heat_index_text = new_text;
+        heat_index_readout.set_text(heat_index_text.c_str());
 
-        stream << std::fixed << std::setprecision(1) << heat_index;
-        std::string heat_index_text = stream.str() + "\u00b0" + "F";
-        lv_label_set_text(heat_index_value_label, heat_index_text.c_str());
-        lv_obj_align(heat_index_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        return true;
     }
 
     // Show the content pane
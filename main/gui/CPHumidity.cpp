@@ -14,8 +14,6 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
-#include <sstream>
-#include <iomanip>  // for set precision
 #include "gui/CPHumidity.h"
 
 #include <smooth/core/logging/log.h>
@@ -27,14 +25,7 @@ namespace redstone
     static const char* TAG = "CPHumidity";
 
     // Constructor
-    CPHumidity::CPHumidity(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
-
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+    CPHumidity::CPHumidity()
     {
     }
 
@@ -67,34 +58,30 @@ namespace redstone
         lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
         lv_obj_set_hidden(content_container, true);
 
-        // create style for humidity value
-        lv_style_init(&humidity_label_style);
-        lv_style_set_text_color(&humidity_label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
-        lv_style_set_text_font(&humidity_label_style, LV_STATE_DEFAULT, &lv_font_14x14B_latin1_sup);
-
-        // create a dynamic label for humidity measurement value
-        humidity_value_label = lv_label_create(content_container, NULL);
-        lv_obj_add_style(humidity_value_label, LV_LABEL_PART_MAIN, &humidity_label_style);
-        lv_label_set_text(humidity_value_label, "--");
-        lv_obj_align(humidity_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        // create a readout for humidity measurement value, it draws the glyphs of
+        // lv_font_14x14B_latin1_sup from a prerendered atlas
+        humidity_readout.create(content_container);
+        humidity_readout.set_text("--");
+        lv_obj_align(humidity_readout.get_obj(), NULL, LV_ALIGN_CENTER, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPHumidity::event(const EnvirValue& event)
+    // Update the humidity readout, the readout is only redrawn when its text changes
+    bool CPHumidity::update_value(const EnvirValue& value)
     {
-        humidity = event.get_relative_humidity();
-        update_humidity_text();
-    }
+        humidity = value.get_relative_humidity();
 
-    // Update the humidity value label
-    void CPHumidity::update_humidity_text()
-    {
-        std::ostringstream stream;
+        FixedPointText<16> new_text{};
+        new_text.format(humidity, 0, " %RH");
+
+        if (new_text == humidity_text)
+        {
+            return false;
+        }
+
+        humidity_text = new_text;
+        humidity_readout.set_text(humidity_text.c_str());
 
-        stream << std::fixed << std::setprecision(0) << humidity;
-        std::string humidity_text = stream.str() + " %RH";
-        lv_label_set_text(humidity_value_label, humidity_text.c_str());
-        lv_obj_align(humidity_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        return true;
     }
 
     // Show the content pane
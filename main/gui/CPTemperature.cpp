@@ -14,8 +14,6 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
-#include <sstream>
-#include <iomanip>  // for set precision
 #include "gui/CPTemperature.h"
 
 #include <smooth/core/logging/log.h>
@@ -27,14 +25,7 @@ namespace redstone
     static const char* TAG = "CPTemperature";
 
     // Constructor
-    CPTemperature::CPTemperature(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
-
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+    CPTemperature::CPTemperature()
     {
     }
 
@@ -67,34 +58,30 @@ namespace redstone
         lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
         lv_obj_set_hidden(content_container, true);
 
-        // create style for temperature value
-        lv_style_init(&temperature_label_style);
-        lv_style_set_text_color(&temperature_label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
-        lv_style_set_text_font(&temperature_label_style, LV_STATE_DEFAULT, &lv_font_14x14B_latin1_sup);
-
-        // create a dynamic label for temperature measurement value
-        temperature_value_label = lv_label_create(content_container, NULL);
-        lv_obj_add_style(temperature_value_label, LV_LABEL_PART_MAIN, &temperature_label_style);
-        lv_label_set_text(temperature_value_label, "--");
-        lv_obj_align(temperature_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        // create a readout for temperature measurement value, it draws the glyphs of
+        // lv_font_14x14B_latin1_sup from a prerendered atlas
+        temperature_readout.create(content_container);
+        temperature_readout.set_text("--");
+        lv_obj_align(temperature_readout.get_obj(), NULL, LV_ALIGN_CENTER, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPTemperature::event(const EnvirValue& event)
+    // Update the temperature readout, the readout is only redrawn when its text changes
+    bool CPTemperature::update_value(const EnvirValue& value)
     {
-        temperature = event.get_temperture_degree_F();
-        update_temperature_text();
-    }
+        temperature = value.get_temperture_degree_F();
 
-    // Update the temperature value label
-    void CPTemperature::update_temperature_text()
-    {
-        std::ostringstream stream;
+        FixedPointText<16> new_text{};
+        new_text.format(temperature, 1, "\u00b0F");
+
+        if (new_text == temperature_text)
+        {
+            return false;
+        }
+
+        temperature_text = new_text;
+        temperature_readout.set_text(temperature_text.c_str());
 
-        stream << std::fixed << std::setprecision(1) << temperature;
-        std::string temp_text = stream.str() + "\u00b0" + "F";
-        lv_label_set_text(temperature_value_label, temp_text.c_str());
-        lv_obj_align(temperature_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
+        return true;
     }
 
     // Show the content pane
@@ -16,21 +16,19 @@
  ***************************************************************************************/
 #pragma once
 
-#include <memory>  // for shared pointer
 #include <lvgl/lvgl.h>
-#include <smooth/core/ipc/IEventListener.h>
-#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
-#include "gui/IPane.h"
+#include "gui/IContentPane.h"
+#include "gui/GuiReadout.h"
+#include "gui/FixedPointText.h"
 #include "model/EnvirValue.h"
 
 namespace redstone
 {
-    class CPTemperature : public IPane, public smooth::core::ipc::IEventListener<EnvirValue>
+    class CPTemperature : public IContentPane
     {
         public:
             /// Constructor
-            /// \param task_lvgl The task this class is running under
-            CPTemperature(smooth::core::Task& task_lvgl);
+            CPTemperature();
 
             /// Show the content pane
             void show() override;
@@ -43,23 +41,19 @@ namespace redstone
             /// \param height The height of the content pane
             void create(int width, int height) override;
 
-            /// The EnvirValue event that this instance listens for
-            void event(const EnvirValue& event) override;
+            /// Update the pane with a new EnvirValue
+            bool update_value(const EnvirValue& value) override;
 
         private:
-            /// Update the temperature text
-            void update_temperature_text();
-
-            // Subscriber's queue's
-            using SubQEnvirValue = smooth::core::ipc::SubscribingTaskEventQueue<EnvirValue>;
-            std::shared_ptr<SubQEnvirValue> subr_queue_envir_value;
-
             lv_style_t plain_style;
             lv_style_t content_container_style;
-            lv_style_t temperature_label_style;
             lv_obj_t* content_container;
-            lv_obj_t* temperature_value_label;
 
             float temperature;
+
+            GuiReadout temperature_readout{};
+
+            // The text shown by the readout, a new value is only drawn when its text differs
+            FixedPointText<16> temperature_text{};
     };
 }
@@ -0,0 +1,110 @@
+/****************************************************************************************
+ * CPTrend.cpp - A content pane that plots the recent temperature and humidity history
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "gui/CPTrend.h"
+#include <algorithm>
+#include <cmath>
+
+#include <smooth/core/logging/log.h>
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "CPTrend";
+    static constexpr lv_coord_t TemperatureMinF = 40;
+    static constexpr lv_coord_t TemperatureMaxF = 100;
+    static constexpr lv_coord_t HumidityMin = 0;
+    static constexpr lv_coord_t HumidityMax = 100;
+
+    // Constructor
+    CPTrend::CPTrend()
+    {
+    }
+
+    // Create the content pane
+    void CPTrend::create(int width, int height)
+    {
+        Log::info(TAG, "Creating CPTrend");
+
+        // create a plain style for the chart background
+        lv_style_init(&chart_bg_style);
+        lv_style_set_pad_all(&chart_bg_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_pad_inner(&chart_bg_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_margin_all(&chart_bg_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_border_width(&chart_bg_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_radius(&chart_bg_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_bg_color(&chart_bg_style, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+
+        // create style for the series, 1 pixel lines without point markers
+        lv_style_init(&chart_series_style);
+        lv_style_set_line_width(&chart_series_style, LV_STATE_DEFAULT, 1);
+        lv_style_set_size(&chart_series_style, LV_STATE_DEFAULT, 0);
+
+        // create the chart
+        chart = lv_chart_create(lv_scr_act(), NULL);
+        lv_obj_set_size(chart, width, height);
+        lv_obj_align(chart, NULL, LV_ALIGN_CENTER, 0, 0);
+        lv_obj_add_style(chart, LV_CHART_PART_BG, &chart_bg_style);
+        lv_obj_add_style(chart, LV_CHART_PART_SERIES_BG, &chart_bg_style);
+        lv_obj_add_style(chart, LV_CHART_PART_SERIES, &chart_series_style);
+        lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+        lv_chart_set_div_line_count(chart, 0, 0);
+        lv_chart_set_point_count(chart, PointCount);
+        lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+        lv_chart_set_y_range(chart, LV_CHART_AXIS_PRIMARY_Y, TemperatureMinF, TemperatureMaxF);
+        lv_chart_set_y_range(chart, LV_CHART_AXIS_SECONDARY_Y, HumidityMin, HumidityMax);
+
+        // temperature on the primary and humidity on the secondary y axis
+        temperature_series = lv_chart_add_series(chart, LV_COLOR_WHITE);
+        humidity_series = lv_chart_add_series(chart, LV_COLOR_WHITE);
+        lv_chart_set_series_axis(chart, humidity_series, LV_CHART_AXIS_SECONDARY_Y);
+        lv_chart_init_points(chart, temperature_series, LV_CHART_POINT_DEF);
+        lv_chart_init_points(chart, humidity_series, LV_CHART_POINT_DEF);
+
+        lv_obj_set_hidden(chart, true);
+    }
+
+    // The published values are deadbanded and come at 10 to 120 sec, plotting them would
+    // stretch and squeeze the time axis
+    bool CPTrend::update_value(const EnvirValue& /*value*/)
+    {
+        return false;
+    }
+
+    // Add the next point, in circular mode LittlevGL only invalidates the columns of the
+    // new point and its neighbours
+    void CPTrend::add_point(const PackedSample& sample)
+    {
+        auto temperature = static_cast<lv_coord_t>(lroundf(sample.get_temperature_degree_C() * 1.8f + 32.0f));
+        auto humidity = static_cast<lv_coord_t>(lroundf(sample.get_relative_humidity()));
+
+        lv_chart_set_next(chart, temperature_series, std::clamp(temperature, TemperatureMinF, TemperatureMaxF));
+        lv_chart_set_next(chart, humidity_series, std::clamp(humidity, HumidityMin, HumidityMax));
+    }
+
+    // Show the content pane
+    void CPTrend::show()
+    {
+        lv_obj_set_hidden(chart, false);
+    }
+
+    // Hide the content pane
+    void CPTrend::hide()
+    {
+        lv_obj_set_hidden(chart, true);
+    }
+}
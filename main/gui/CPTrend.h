@@ -0,0 +1,60 @@
+/****************************************************************************************
+ * CPTrend.h - A content pane that plots the recent temperature and humidity history
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <lvgl/lvgl.h>
+#include "gui/IContentPane.h"
+#include "model/EnvirValue.h"
+#include "model/SampleHistory.h"
+
+namespace redstone
+{
+    // The chart is updated in circular mode: a new sample overwrites the oldest point and
+    // only the columns around that point are invalidated.  Shifting the whole plot by one
+    // point would move every pixel of the chart and invalidate all of it on each sample.
+    class CPTrend : public IContentPane
+    {
+        public:
+            // One point per 30 sec recorded sample, one pixel column per point, 64 minutes
+            static constexpr uint16_t PointCount = 128;
+
+            /// Constructor
+            CPTrend();
+
+            /// Show the content pane
+            void show() override;
+
+            /// Hide the content pane
+            void hide() override;
+
+            /// Create the content pane
+            /// \param width The width of the content pane
+            /// \param height The height of the content pane
+            void create(int width, int height) override;
+
+            /// The published values are not plotted, the chart only moves on the 30 sec grid
+            /// \return Returns false, no value label is redrawn
+            bool update_value(const EnvirValue& value) override;
+
+            /// Add a recorded sample as the next point of the plot
+            /// \param sample The sample recorded on the 30 sec grid
+            void add_point(const PackedSample& sample);
+
+        private:
+            lv_style_t chart_bg_style;
+            lv_style_t chart_series_style;
+            lv_obj_t* chart;
+            lv_chart_series_t* temperature_series;
+            lv_chart_series_t* humidity_series;
+    };
+}
@@ -15,7 +15,13 @@
  * Licensed under MIT License
  ***************************************************************************************/
 #include "gui/DisplayDriver.h"
+#include <algorithm>
 #include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+#include <sdkconfig.h>
+#include <smooth/core/io/spi/Master.h>
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
 #include <smooth/core/logging/log.h>
 
 using namespace smooth::core::io::spi;
@@ -27,6 +33,7 @@ namespace redstone
 {
     // Class Constants
     static const char* TAG = "DisplayDriver";
+    static constexpr uint32_t CyclesPerMicrosecond = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
 
     // Constructor
     DisplayDriver::DisplayDriver()
@@ -48,13 +55,23 @@ namespace redstone
             // initialize LittlevGL graphics library
             lv_init();
 
-            // The video_display_buffer1 is used by LittlevGL to draw screen content.
-            // Verfiy that DMA buffer - video_display_buffer1 has been allocated.
-            if (video_display_buffer1.is_buffer_allocated())
+            // The video display buffers are used by LittlevGL to draw screen content.
+            // Verfiy that both DMA buffers have been allocated.
+            if (video_display_buffer1.is_buffer_allocated() && video_display_buffer2.is_buffer_allocated())
             {
-                // initialize a display buffer
+                // start with a blank display so the shadow frame buffer is known to be valid
+                clear_display_ram();
+
+                // initialize a double display buffer, LittlevGL draws into one buffer while the
+                // other one is sent by DMA.  set_px_cb packs 8 pixels into each byte and always
+                // uses a stride of 64 columns, so each buffer is a full 1024 bytes, but only half a
+                // screen (32 rows in landscape) is handed to LittlevGL.  A full redraw is then
+                // flushed in two parts and the second part is drawn while the first is sent.
+                // A full screen size would make LittlevGL treat the buffers as true double
+                // buffers, which copies pixels between them in its own layout.
                 vdb1 = reinterpret_cast<lv_color1_t*>(video_display_buffer1.data());
-                lv_disp_buf_init(&disp_buf, vdb1, NULL, MAX_DMA_LEN);
+                vdb2 = reinterpret_cast<lv_color1_t*>(video_display_buffer2.data());
+                lv_disp_buf_init(&disp_buf, vdb1, vdb2, MAX_DMA_LEN * 4);
 
                 // initialize and register a display driver
                 lv_disp_drv_init(&disp_drv);
@@ -89,45 +106,29 @@ namespace redstone
                         GPIO_NUM_18,                   // clock gpio pin
                         MAX_DMA_LEN);                  // max transfer size
         
-        // create the LCDSpi device
-        auto device = Master::create_device<LCDSpi>(
-                        GPIO_NUM_14,            // chip select gpio pin
-                        GPIO_NUM_27,            // data command gpio pin
-                        0,                      // spi command_bits
-                        0,                      // spi address_bits,
-                        0,                      // bits_between_address_and_data_phase,
-                        0,                      // spi_mode = 0,
-                        128,                    // spi positive_duty_cycle,
-                        0,                      // spi cs_ena_posttrans,
-                        SPI_MASTER_FREQ_8M,     // spi-sck = 8MHz
-                        0,                      // full duplex (4-wire)
-                        1,                      // queue_size,
-                        true,                   // use pre-trans callback
-                        true);                  // use post-trans callback
-
-        bool lcdspi_device_initialized = device->init(VSPI_HOST);
-
-        if (lcdspi_device_initialized)
+        // add the SH1107 to the bus, it queues the page transfers of a flush so the
+        // flush callback returns while the DMA is still sending
+        bool spi_device_initialized = lcd_display.initialize(VSPI_HOST);
+
+        if (spi_device_initialized)
         {
-            // add reset pin - pullup=false, pulldown=false, active_high=false
-            device->add_reset_pin(std::make_unique<DisplayPin>(GPIO_NUM_33, false, false, false));
-            device->hw_reset(true, milliseconds(5), milliseconds(120));  // reset chip
+            lcd_display.set_done_callback(flush_done_cb, this);
+            lcd_display.hw_reset(milliseconds(5), milliseconds(120));  // reset chip
         }
         else
         {
-            Log::error(TAG, "Initializing of LCDspi Device: FAILED");
+            Log::error(TAG, "Initializing of SH1107 SPI Device: FAILED");
         }
 
         // initialize the display
-        bool sh1107_initialized = device->send_cmds(sh1107_init_cmds_1.data(), sh1107_init_cmds_1.size());
-        lcd_display = std::move(device);
+        bool sh1107_initialized = lcd_display.send_cmds(sh1107_init_cmds_1.data(), sh1107_init_cmds_1.size());
 
         if (!sh1107_initialized)
         {
             Log::error(TAG, "Initializing of SH1107 --- FAILED");
         }
 
-        return lcdspi_device_initialized & sh1107_initialized;
+        return spi_device_initialized & sh1107_initialized;
     }
 
     // Set screen rotation
@@ -139,7 +140,7 @@ namespace redstone
         // lv_config file has oreintation set for landscape
         if (LV_HOR_RES_MAX > LV_VER_RES_MAX)
         {
-            res = lcd_display->send_cmd(SH1107Cmd::CommonOutputScanDirLandscape);
+            res = lcd_display.send_cmd(SH1107Cmd::CommonOutputScanDirLandscape);
         }
 
         if (!res)
@@ -151,6 +152,8 @@ namespace redstone
     // A class instance callback to flush the display buffer and thereby write colors to screen
     void DisplayDriver::display_drv_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
     {
+        ScopedTiming timing(TimingStats::DisplayFlush);
+
         uint8_t start_col;
         uint8_t end_col;
         uint8_t start_page;
@@ -173,47 +176,92 @@ namespace redstone
             end_page = area->x2 >> 3;   // end row on page boundary
         }
 
-        for (uint8_t page = start_page; page <= end_page; page++)
+        TraceRing::record(TraceEventType::FlushStart, start_page);
+
+        // LittlevGL only calls the flush callback after the previous flush is done, so the
+        // transactions of the previous batch are all complete and are collected in one go
+        lcd_display.collect_results();
+        flushing_drv = drv;
+
+        if (lv_disp_flush_is_last(drv) && frame_pending)
+        {
+            frame_ending = true;
+        }
+
+        // Only send the part of each page that differs from what the SH1107 is already showing.
+        // All page command/data pairs are prepared first and then queued back to back.
+        if (!page_flush.prepare_area(start_page, end_page, start_col, end_col, reinterpret_cast<uint8_t*>(color_map)))
         {
-            send_page_commands(page, start_col);
-            send_page_data(reinterpret_cast<uint8_t*>(color_map), static_cast<uint8_t>(end_col - start_col + 1));
-            color_map += SH1107_COLUMNS;
+            Log::error(TAG, "Failed to prepare the page transfers");
         }
 
-        // Inform the lvgl graphics library that we are ready for flushing buffer
-        lv_disp_t* disp = _lv_refr_get_disp_refreshing();
-        lv_disp_flush_ready(&disp->driver);
+        // The last data transaction tells lvgl that the buffer can be reused, if nothing was
+        // queued there is nothing to wait for
+        bool queued = lcd_display.submit(true);
+
+        TraceRing::record(TraceEventType::FlushEnd, end_page);
+
+        if (!queued)
+        {
+            flush_done();
+        }
+    }
+
+    // Start timing a frame
+    void DisplayDriver::begin_frame()
+    {
+        begin_frame(TimingStats::DisplayFrame, esp_timer_get_time());
+    }
+
+    // Start timing a frame from an earlier event
+    void DisplayDriver::begin_frame(TimingStats::Probe probe, int64_t start_us)
+    {
+        frame_start_us = start_us;
+        frame_probe = probe;
+        frame_pending = true;
+    }
+
+    // The "C" style callback from the SPI interrupt
+    void IRAM_ATTR DisplayDriver::flush_done_cb(void* context)
+    {
+        reinterpret_cast<DisplayDriver*>(context)->flush_done();
     }
 
-    // To send a page of pixel data we have to send a command to set the upper column
-    // address bits and then send a command to set the lower column address bits
-    // and then send a command to set the page address before sending the pixel data itself.
-    void DisplayDriver::send_page_commands(uint8_t page_number, uint8_t start_col)
+    // Inform the lvgl graphics library that we are ready for flushing buffer, called from the
+    // SPI interrupt or from the flush callback when nothing had to be sent
+    void IRAM_ATTR DisplayDriver::flush_done()
     {
-        // set page address and column address
-        page_commands[0] = SH1107Cmd::UpperColumnAddress | ((start_col >> 4) & 0x0F);
-        page_commands[1] = SH1107Cmd::LowerColumnAddress | (start_col & 0x0F);
-        page_commands[2] = SH1107Cmd::PageAddress0 | page_number;
+        TraceRing::record(TraceEventType::FlushDone);
 
-        if (!lcd_display->send_cmds(page_commands.data(), 3))
+        if (frame_ending)
         {
-            Log::error(TAG, "Failed to send page commands");
+            frame_ending = false;
+            frame_pending = false;
+            auto frame_us = static_cast<uint32_t>(esp_timer_get_time() - frame_start_us);
+            TimingStats::instance().record(frame_probe, frame_us * CyclesPerMicrosecond);
         }
+
+        lv_disp_flush_ready(flushing_drv);
     }
 
-    // Send pixel data
-    void DisplayDriver::send_page_data(uint8_t* data, size_t length)
+    // Clear the SH1107 display ram so that it matches the zeroed shadow frame buffer
+    void DisplayDriver::clear_display_ram()
     {
-        if (!lcd_display->send_data(data, length))
+        std::fill(video_display_buffer1.data(), video_display_buffer1.data() + MAX_DMA_LEN, 0);
+
+        if (!page_flush.prepare_clear(video_display_buffer1.data()))
         {
-            Log::error(TAG, "Failed to send page data");
+            Log::error(TAG, "Failed to prepare the page transfers");
         }
+
+        lcd_display.submit(false);
+        lcd_display.collect_results();
     }
 
     // The "C" style callback, rounder increase the y1, y2 to byte boundary
     void IRAM_ATTR DisplayDriver::rounder_cb(struct _disp_drv_t* disp_drv, lv_area_t* area)
     {
-        if (LV_VER_RES_MAX > LV_HOR_RES_MAX)
+        if constexpr (LV_VER_RES_MAX > LV_HOR_RES_MAX)
         {
             // Portrait
             area->y1 = area->y1 & ~0x7;
@@ -237,32 +285,18 @@ namespace redstone
                                             lv_color_t color,
                                             lv_opa_t opa)
     {
-        uint16_t buf_index;
-        uint8_t bit_index;
-
-        if (LV_VER_RES_MAX > LV_HOR_RES_MAX)
-        {
-            // Potrait
-            buf_index = x + (SH1107_COLUMNS * (y >> 3));
-            bit_index = y & 0x07;
-        }
-        else
-        {
-            // Landscape
-            buf_index = y + (SH1107_COLUMNS * (x >> 3));
-            bit_index = x & 0x07;
-        }
-
-        if (color.full == 0)
-        {
-            // clear the bit
-            buf[buf_index] &= static_cast<uint8_t>(~(1 << bit_index));
-        }
-        else
-        {
-            // set the bit
-            buf[buf_index] |= static_cast<uint8_t>(1 << bit_index);
-        }
+        // The orientation is fixed at compile time so only one index calculation is compiled in.
+        // Portrait: column = x, row = y  Landscape: column = y, row = x
+        constexpr bool portrait = LV_VER_RES_MAX > LV_HOR_RES_MAX;
+        lv_coord_t column = portrait ? x : y;
+        lv_coord_t row = portrait ? y : x;
+
+        uint8_t* pixels = &buf[column + (SH1107_COLUMNS * (row >> 3))];
+        uint8_t bit_mask = static_cast<uint8_t>(1 << (row & 0x07));
+
+        // color.full is 0 or 1, turn it into 0x00 or 0xFF and merge the bit in without branching
+        uint8_t color_mask = static_cast<uint8_t>(0 - (color.full & 0x01));
+        *pixels = static_cast<uint8_t>((*pixels & ~bit_mask) | (color_mask & bit_mask));
     }
 
     // The "C" style callback required by LittlevGL
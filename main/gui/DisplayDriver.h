@@ -17,9 +17,12 @@
 #pragma once
 
 #include <lvgl/lvgl.h>
-#include <smooth/application/display/LCDSpi.h>
 #include <smooth/application/display/SH1107.h>
 #include <smooth/core/io/spi/SpiDmaFixedBuffer.h>
+#include "gui/SH1107FrameBuffer.h"
+#include "gui/SH1107PageFlush.h"
+#include "gui/SH1107Spi.h"
+#include "stats/TimingStats.h"
 
 namespace redstone
 {
@@ -32,6 +35,29 @@ namespace redstone
             /// Initialize the display driver
             bool initialize();
 
+            /// Get the number of SPI transactions sent to the SH1107
+            /// \return Returns the count of command and data transactions since power up
+            uint32_t get_spi_transaction_count() const
+            {
+                return page_flush.get_transaction_count();
+            }
+
+            /// Start timing a frame, e.g. a view switch, the frame ends when the last byte of the
+            /// next full refresh is out on the SPI bus
+            void begin_frame();
+
+            /// Start timing a frame from an earlier event, a new frame replaces one still pending
+            /// \param probe The probe the frame time is recorded in
+            /// \param start_us The esp_timer time the frame is timed from, e.g. a button edge
+            void begin_frame(TimingStats::Probe probe, int64_t start_us);
+
+            /// Get the shadow frame buffer
+            /// \return Returns the copy of what the SH1107 display ram is currently showing
+            const SH1107FrameBuffer& get_frame_buffer() const
+            {
+                return page_flush.get_frame_buffer();
+            }
+
         private:
             /// SH1107 Flush Callback - C style callback required by LittlevGL
             /// \param drv The display driver structure reference, not used
@@ -69,21 +95,21 @@ namespace redstone
             // This contains thedata that should be flushed to the display
             void display_drv_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map);
 
+            /// Flush Done Callback - called from the SPI interrupt when the last transaction of a flush is out
+            /// \param context The DisplayDriver instance
+            static void flush_done_cb(void* context);
+
+            /// Flush Done
+            /// Hands the video display buffer back to LittlevGL and ends a timed frame
+            void flush_done();
+
             /// Initialize the SH1107
             /// \return Returns true is successful false if initialization failed
             bool init_lcd_display();
 
-            /// Send Page Commands
-            /// Sends command to display for setting up a page pixel data transfer
-            /// \param page_number The page number to send to display
-            /// \param start_col The starting column position
-            void send_page_commands(uint8_t page_number, uint8_t start_col);
-
-            /// Send Page Data
-            /// Sends a full or a portion of a page worth of pixel data to display
-            /// \param data The pointer to the first byte in the data (pixel data)
-            /// \param length The number of bytes in the data
-            void send_page_data(uint8_t* data, size_t length);
+            /// Clear Display Ram
+            /// Blanks the SH1107 display ram and the shadow frame buffer so they start out the same
+            void clear_display_ram();
 
             // Set the screen rotation
             void set_screen_rotation();
@@ -93,20 +119,37 @@ namespace redstone
             static constexpr int SH1107_PAGES = 16;
             static constexpr int SH1107_SEGMENTS = 128;
             static constexpr int MAX_DMA_LEN = SH1107_SEGMENTS * SH1107_PAGES; // 128 * 16 = 1024
-            static constexpr int SH1107_PAGE_CMD_LEN = 64;
+            static constexpr int SH1107_PAGE_CMD_LEN = SH1107PageFlush<SH1107Spi>::CmdBufferLen;
 
             //spi_host_device_t spi_host;
             //smooth::core::io::spi::Master spi_master;
 
-            std::unique_ptr<smooth::application::display::LCDSpi> lcd_display{};
+            SH1107Spi lcd_display{ GPIO_NUM_14,             // chip select gpio pin
+                                   GPIO_NUM_27,             // data command gpio pin
+                                   GPIO_NUM_33,             // reset gpio pin
+                                   SPI_MASTER_FREQ_8M };    // spi-sck = 8MHz
             bool display_initialized{ false };
 
             lv_theme_t* theme;
             lv_disp_drv_t disp_drv;
             lv_disp_buf_t disp_buf;
             lv_color1_t* vdb1;
+            lv_color1_t* vdb2;
 
             smooth::core::io::spi::SpiDmaFixedBuffer<uint8_t, MAX_DMA_LEN> video_display_buffer1{};
+            smooth::core::io::spi::SpiDmaFixedBuffer<uint8_t, MAX_DMA_LEN> video_display_buffer2{};
             smooth::core::io::spi::SpiDmaFixedBuffer<uint8_t, SH1107_PAGE_CMD_LEN> page_commands;
+
+            // Sends only what differs from what the SH1107 display ram is currently showing
+            SH1107PageFlush<SH1107Spi> page_flush{ lcd_display, page_commands.data() };
+
+            // The driver being flushed, handed back to LittlevGL from the SPI interrupt
+            lv_disp_drv_t* flushing_drv{ nullptr };
+
+            // Frame timing, frame_ending is set when the last flush of a timed frame is queued
+            int64_t frame_start_us{ 0 };
+            TimingStats::Probe frame_probe{ TimingStats::DisplayFrame };
+            bool frame_pending{ false };
+            volatile bool frame_ending{ false };
     };
 }
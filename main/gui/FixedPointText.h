@@ -0,0 +1,129 @@
+/****************************************************************************************
+ * FixedPointText.h - Formats a value with a fixed number of decimals and a unit suffix
+ *                    into a fixed size buffer without using the heap
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace redstone
+{
+    // The text matches std::fixed << std::setprecision(precision) << value followed by the
+    // suffix, for precision 0 to 3 and values below 1e15 in magnitude so the scaled value fits
+    // in 64 bits.  The value is scaled in double precision, which is exact for
+    // a float times 10^precision, and rounded to nearest with ties to even just like printf.
+    template<size_t Capacity>
+    class FixedPointText
+    {
+        public:
+            /// Format a value
+            /// \param value The value to format
+            /// \param precision The number of digits after the decimal point, 0 to 3
+            /// \param suffix The unit suffix, a UTF-8 string such as "°F" or " %RH"
+            /// \return Returns the formatted null terminated text
+            const char* format(float value, int precision, const char* suffix)
+            {
+                length = 0;
+
+                if (std::isnan(value))
+                {
+                    append("nan");
+                }
+                else if (std::isinf(value))
+                {
+                    append(value < 0 ? "-inf" : "inf");
+                }
+                else
+                {
+                    append_fixed(value, precision);
+                }
+
+                append(suffix);
+                text[length] = '\0';
+
+                return text.data();
+            }
+
+            /// Get the formatted text
+            const char* c_str() const
+            {
+                return text.data();
+            }
+
+            /// Compare the formatted text
+            bool operator==(const FixedPointText& other) const
+            {
+                return length == other.length && std::equal(text.begin(), text.begin() + length, other.text.begin());
+            }
+
+        private:
+            void append_fixed(float value, int precision)
+            {
+                static constexpr uint32_t powers_of_ten[] = { 1, 10, 100, 1000 };
+                uint32_t scale = powers_of_ten[precision];
+
+                uint64_t scaled = static_cast<uint64_t>(std::nearbyint(std::fabs(static_cast<double>(value)) * scale));
+                uint64_t integer_part = scaled / scale;
+                uint32_t fraction_part = static_cast<uint32_t>(scaled % scale);
+
+                if (std::signbit(value))
+                {
+                    append_char('-');
+                }
+
+                // integer digits are produced in reverse order
+                char digits[20];
+                int digit_count = 0;
+
+                do
+                {
+                    digits[digit_count++] = static_cast<char>('0' + (integer_part % 10));
+                    integer_part /= 10;
+                }
+                while (integer_part > 0);
+
+                while (digit_count > 0)
+                {
+                    append_char(digits[--digit_count]);
+                }
+
+                if (precision > 0)
+                {
+                    append_char('.');
+
+                    for (uint32_t divisor = scale / 10; divisor > 0; divisor /= 10)
+                    {
+                        append_char(static_cast<char>('0' + (fraction_part / divisor) % 10));
+                    }
+                }
+            }
+
+            void append(const char* str)
+            {
+                while (*str != '\0')
+                {
+                    append_char(*str++);
+                }
+            }
+
+            void append_char(char c)
+            {
+                // keep room for the null terminator, the text is truncated if it does not fit
+                if (length < Capacity - 1)
+                {
+                    text[length++] = c;
+                }
+            }
+
+            std::array<char, Capacity> text{};
+            size_t length{ 0 };
+    };
+}
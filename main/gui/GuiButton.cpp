@@ -28,9 +28,19 @@ namespace redstone
     {
         GuiButton* the_user = reinterpret_cast<GuiButton*>(obj->user_data);
 
-        if (event == LV_EVENT_CLICKED)
+        if (event == LV_EVENT_PRESSED)
         {
-            the_user->on_clicked(obj);
+            // a suppressed release that never produced a click does not carry over
+            the_user->click_suppressed = false;
+        }
+        else if (event == LV_EVENT_CLICKED)
+        {
+            if (!the_user->click_suppressed)
+            {
+                the_user->on_clicked(obj);
+            }
+
+            the_user->click_suppressed = false;
         }
     }
 
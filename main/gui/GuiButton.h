@@ -49,6 +49,13 @@ namespace redstone
             /// \param return Returns the button coordinates
             lv_area_t get_coords();
 
+            /// Do not call on_clicked for the release Lvgl is about to process, e.g. because the
+            /// press was a long press that did something else
+            void suppress_click()
+            {
+                click_suppressed = true;
+            }
+
             /// Create the button
             /// \param parent The parent of this button
             /// \param return Returns the created lvgl button object
@@ -65,5 +72,7 @@ namespace redstone
             lv_obj_t* gui_button;
 
             lv_style_t gui_btn_style;
+
+            bool click_suppressed{ false };
     };
 }
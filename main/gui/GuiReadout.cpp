@@ -0,0 +1,130 @@
+/****************************************************************************************
+ * GuiReadout.cpp - A numeric readout drawn from a prerendered glyph atlas
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "gui/GuiReadout.h"
+#include <algorithm>
+#include "gui/SH1107FrameBuffer.h"
+
+namespace redstone
+{
+    // The atlas cells are in the landscape page layout, pages run along x
+    static_assert(LV_HOR_RES_MAX > LV_VER_RES_MAX, "The readout glyph atlas is in the landscape page layout");
+
+    static constexpr int TextPages = GuiReadout::MaxChars * ReadoutGlyphAtlas::CellPages;
+
+    // Constructor
+    GuiReadout::GuiReadout()
+    {
+    }
+
+    // Create the readout, the base object only provides the coordinates, the drawing is done
+    // by design_cb
+    lv_obj_t* GuiReadout::create(lv_obj_t* parent)
+    {
+        readout = lv_obj_create(parent, NULL);
+        lv_obj_set_size(readout, MaxChars * ReadoutGlyphAtlas::CellWidth, ReadoutGlyphAtlas::CellColumns);
+        lv_obj_set_click(readout, false);
+        lv_obj_set_design_cb(readout, design_cb);
+        readout->user_data = this;
+
+        return readout;
+    }
+
+    // Map the text to atlas cells and redraw the readout if any cell changed
+    bool GuiReadout::set_text(const char* text)
+    {
+        std::array<uint8_t, MaxChars> new_glyphs{};
+        int new_length = 0;
+        uint32_t i = 0;
+
+        while (text[i] != '\0' && new_length < MaxChars)
+        {
+            new_glyphs[new_length++] = find_glyph(_lv_txt_encoded_next(text, &i));
+        }
+
+        if (new_length == length && new_glyphs == glyphs)
+        {
+            return false;
+        }
+
+        glyphs = new_glyphs;
+        length = new_length;
+        lv_obj_invalidate(readout);
+
+        return true;
+    }
+
+    // The "C" style callback, the readout draws every byte of its area so it covers what is below it
+    lv_design_res_t GuiReadout::design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode)
+    {
+        if (mode == LV_DESIGN_COVER_CHK)
+        {
+            return _lv_area_is_in(clip_area, &obj->coords, 0) ? LV_DESIGN_RES_COVER : LV_DESIGN_RES_NOT_COVER;
+        }
+
+        if (mode == LV_DESIGN_DRAW_MAIN)
+        {
+            reinterpret_cast<GuiReadout*>(obj->user_data)->draw(clip_area);
+        }
+
+        return LV_DESIGN_RES_OK;
+    }
+
+    // The rounder callback of the display driver puts the video display buffer and the redrawn
+    // areas on page boundaries, so every page of the readout is either drawn whole or not at all
+    // and each column of a page is a single byte copy.
+    void GuiReadout::draw(const lv_area_t* clip_area)
+    {
+        lv_disp_buf_t* vdb = lv_disp_get_buf(_lv_refr_get_disp_refreshing());
+        uint8_t* buf = reinterpret_cast<uint8_t*>(vdb->buf_act);
+        const lv_area_t& coords = readout->coords;
+
+        lv_coord_t first_col = std::max(clip_area->y1, coords.y1);
+        lv_coord_t last_col = std::min(clip_area->y2, coords.y2);
+        int first_text_page = (TextPages - length * ReadoutGlyphAtlas::CellPages) / 2;
+
+        for (int page = 0; page < TextPages; page++)
+        {
+            lv_coord_t x = coords.x1 + page * 8;
+
+            if (x < clip_area->x1 || x > clip_area->x2)
+            {
+                continue;
+            }
+
+            // cell 0 is blank
+            int text_page = page - first_text_page;
+            const uint8_t* cell = ReadoutGlyphAtlas::cells.data();
+
+            if (text_page >= 0 && text_page < length * ReadoutGlyphAtlas::CellPages)
+            {
+                cell += glyphs[text_page / ReadoutGlyphAtlas::CellPages] * ReadoutGlyphAtlas::CellSize
+                        + (text_page % ReadoutGlyphAtlas::CellPages) * ReadoutGlyphAtlas::CellColumns;
+            }
+
+            uint8_t* dest = &buf[SH1107FrameBuffer::Columns * ((x - vdb->area.x1) >> 3)];
+
+            for (lv_coord_t col = first_col; col <= last_col; col++)
+            {
+                dest[col - vdb->area.y1] = cell[col - coords.y1];
+            }
+        }
+    }
+
+    // Find the atlas cell of a character
+    uint8_t GuiReadout::find_glyph(uint32_t code)
+    {
+        auto it = std::find(ReadoutGlyphAtlas::codes.begin(), ReadoutGlyphAtlas::codes.end(), code);
+
+        return it == ReadoutGlyphAtlas::codes.end() ? 0 : static_cast<uint8_t>(it - ReadoutGlyphAtlas::codes.begin());
+    }
+}
@@ -0,0 +1,77 @@
+/****************************************************************************************
+ * GuiReadout.h - A numeric readout drawn from a prerendered glyph atlas
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <lvgl/lvgl.h>
+#include "fonts/ReadoutGlyphAtlas.h"
+
+namespace redstone
+{
+    // A one line readout for values like "72.5°F" or "45 %RH".  An lv_label draws each update
+    // glyph by glyph and pixel by pixel through set_px_cb.  The readout instead copies whole
+    // bytes of the glyph atlas, which is prerendered in the SH1107 page layout, straight into
+    // the video display buffer, so a full value change is a few hundred byte copies.
+    //
+    // The readout is as wide as the screen and one cell high.  Its x position must be on a
+    // page boundary (a multiple of 8), which a full width object in a full width container is.
+    // The text is centered in steps of half a cell and characters that are not in the atlas
+    // are left blank.
+    class GuiReadout
+    {
+        public:
+            static constexpr int MaxChars = LV_HOR_RES_MAX / ReadoutGlyphAtlas::CellWidth;
+
+            /// Constructor
+            GuiReadout();
+
+            /// Create the readout
+            /// \param parent The parent of the readout
+            /// \return Returns the created lvgl object
+            lv_obj_t* create(lv_obj_t* parent);
+
+            /// Set the text, the readout is only redrawn when the text changes
+            /// \param text The UTF-8 text, characters after the first MaxChars are dropped
+            /// \return Returns true if the text changed
+            bool set_text(const char* text);
+
+            /// Get the pointer to the readout
+            /// \return Returns the lvgl object of the readout
+            lv_obj_t* get_obj()
+            {
+                return readout;
+            }
+
+        private:
+            /// A "C" style callback required by Lvgl for drawing the object
+            /// \param obj The lvgl object of the readout
+            /// \param clip_area The area that is being redrawn
+            /// \param mode The drawing phase
+            /// \return Returns if the readout covers the area for LV_DESIGN_COVER_CHK
+            static lv_design_res_t design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode);
+
+            /// Copy the atlas cells of the text into the video display buffer
+            /// \param clip_area The area that is being redrawn
+            void draw(const lv_area_t* clip_area);
+
+            /// Find the atlas cell of a character
+            /// \param code The unicode of the character
+            /// \return Returns the cell index, 0 (blank) if the character is not in the atlas
+            static uint8_t find_glyph(uint32_t code);
+
+            lv_obj_t* readout{ nullptr };
+            std::array<uint8_t, MaxChars> glyphs{};
+            int length{ 0 };
+    };
+}
@@ -0,0 +1,48 @@
+/****************************************************************************************
+ * HwButtonEdge.h - A debounced hardware button edge sent from the gpio interrupt
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace redstone
+{
+    class HwButtonEdge
+    {
+        public:
+            HwButtonEdge() = default;
+
+            HwButtonEdge(int btn_id, bool pressed, int64_t time_us)
+                    : btn_id(btn_id), pressed(pressed), time_us(time_us)
+            {
+            }
+
+            /// Get the id of the button
+            int get_btn_id() const
+            {
+                return btn_id;
+            }
+
+            /// Get the debounced button state after the edge
+            bool is_pressed() const
+            {
+                return pressed;
+            }
+
+            /// Get the time of the edge
+            /// \return Returns the esp_timer time of the edge in microseconds
+            int64_t get_time_us() const
+            {
+                return time_us;
+            }
+
+        private:
+            int btn_id{ 0 };
+            bool pressed{ false };
+            int64_t time_us{ 0 };
+    };
+}
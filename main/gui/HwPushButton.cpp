@@ -0,0 +1,80 @@
+/****************************************************************************************
+ * HwPushButton.cpp - A class that creates a hardware PUSHBUTTON
+ *
+ * Created on Jan. 04, 2020
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "gui/HwPushButton.h"
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include "stats/TraceRing.h"
+
+namespace redstone
+{
+    // Constructor
+    HwPushButton::HwPushButton(int btn_id, gpio_num_t pin, bool pullup, bool pulldn,
+                               smooth::core::ipc::IISRTaskEventQueue<HwButtonEdge>* queue)
+            : btn_id(btn_id), pin(pin), queue(queue)
+    {
+        gpio_config_t config{};
+        config.pin_bit_mask = 1ULL << pin;
+        config.mode = GPIO_MODE_INPUT;
+        config.pull_up_en = pullup ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE;
+        config.pull_down_en = pulldn ? GPIO_PULLDOWN_ENABLE : GPIO_PULLDOWN_DISABLE;
+        config.intr_type = GPIO_INTR_ANYEDGE;
+        gpio_config(&config);
+
+        debounced_pressed = is_button_pressed();
+
+        // The isr service may already be installed by another driver, that is not an error
+        gpio_install_isr_service(0);
+        gpio_isr_handler_add(pin, gpio_isr_handler, this);
+    }
+
+    // Destructor
+    HwPushButton::~HwPushButton()
+    {
+        gpio_isr_handler_remove(pin);
+    }
+
+    // Resynchronize the debounced state
+    bool HwPushButton::resync()
+    {
+        gpio_intr_disable(pin);
+        debounced_pressed = is_button_pressed();
+        gpio_intr_enable(pin);
+
+        return debounced_pressed;
+    }
+
+    // The edge interrupt - an edge is accepted when it changes the debounced state and
+    // is outside the bounce window of the previously accepted edge
+    void IRAM_ATTR HwPushButton::gpio_isr_handler(void* arg)
+    {
+        auto btn = reinterpret_cast<HwPushButton*>(arg);
+        bool pressed = gpio_get_level(btn->pin) == 0;
+        int64_t now = esp_timer_get_time();
+
+        if (pressed == btn->debounced_pressed || now - btn->last_edge_us < DebounceTimeUs)
+        {
+            // contact bounce
+            return;
+        }
+
+        btn->debounced_pressed = pressed;
+        btn->last_edge_us = now;
+        TraceRing::record(TraceEventType::ButtonEdge, static_cast<uint16_t>(btn->btn_id | (pressed ? 0x100 : 0)));
+
+        btn->queue->signal(HwButtonEdge(btn->btn_id, pressed, now));
+    }
+}
@@ -16,7 +16,9 @@
  ***************************************************************************************/
 #pragma once
 
-#include <smooth/core/io/Input.h>
+#include <driver/gpio.h>
+#include <smooth/core/ipc/IISRTaskEventQueue.h>
+#include "gui/HwButtonEdge.h"
 
 namespace redstone
 {
@@ -24,15 +26,45 @@ namespace redstone
     {
         public:
             /// Constructor
-            HwPushButton(gpio_num_t pin, bool pullup, bool pulldn) : hw_btn(pin, pullup, pulldn) {};
+            /// \param btn_id The id of the menu button this hardware button belongs to
+            /// \param pin The gpio pin of the button, the button is active low
+            /// \param pullup Enable the internal pullup
+            /// \param pulldn Enable the internal pulldown
+            /// \param queue The queue that is signalled from the interrupt with each debounced edge,
+            /// it must outlive the button, MenuPane owns both and destroys the buttons first
+            HwPushButton(int btn_id, gpio_num_t pin, bool pullup, bool pulldn,
+                         smooth::core::ipc::IISRTaskEventQueue<HwButtonEdge>* queue);
+
+            /// Destructor
+            ~HwPushButton();
 
             /// Is button pressed
+            /// \return Returns the current level of the button pin, not debounced
             bool is_button_pressed()
             {
-                return !hw_btn.read();
+                return gpio_get_level(pin) == 0;
             };
 
+            /// Resynchronize the debounced state with the button pin, used when an edge
+            /// was lost inside a debounce window
+            /// \return Returns the resynchronized debounced state
+            bool resync();
+
         private:
-            smooth::core::io::Input hw_btn;
+            /// The gpio edge interrupt handler
+            /// \param arg The HwPushButton instance
+            static void gpio_isr_handler(void* arg);
+
+            // An edge less than this long after the last accepted edge is contact bounce
+            static constexpr int64_t DebounceTimeUs = 20 * 1000;
+
+            int btn_id;
+            gpio_num_t pin;
+            // A plain pointer, locking a weak_ptr is not safe from an interrupt
+            smooth::core::ipc::IISRTaskEventQueue<HwButtonEdge>* queue;
+
+            // Written only by the interrupt handler, except for resync()
+            volatile bool debounced_pressed{ false };
+            volatile int64_t last_edge_us{ 0 };
     };
 }
@@ -0,0 +1,26 @@
+/****************************************************************************************
+ * IContentPane.h - An abstract class that content panes implement to be able to show
+ *                  the latest EnvirValue
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include "gui/IPane.h"
+#include "model/EnvirValue.h"
+
+namespace redstone
+{
+    class IContentPane : public IPane
+    {
+        public:
+            virtual ~IContentPane() {};
+
+            /// Update the pane with a new EnvirValue
+            /// \param value The latest EnvirValue
+            /// \return Returns true if the value label was redrawn, false if its text did not change
+            virtual bool update_value(const EnvirValue& value) = 0;
+    };
+}
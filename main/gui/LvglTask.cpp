@@ -14,25 +14,32 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
+#include <algorithm>
 #include "gui/LvglTask.h"
+#include "stats/TimingStats.h"
 
 using namespace std::chrono;
 using namespace smooth::core;
+using namespace smooth::core::timer;
 
 namespace redstone
 {
     // Class constants
     static const char* TAG = "LvglTask";
+    static constexpr int RefreshTimerId = 1;
 
     // Constructor
     LvglTask::LvglTask()
-            : Task("LvglTask", 4096, 10, milliseconds(100)),
+            : Task("LvglTask", 4096, 10, seconds(10)),
 
               // The Task Name = "LvglTask"
               // The stack size is 4096 bytes
               // The priority is set to 10
-              // The tick interval is 100ms
+              // The tick interval is 10 sec, LittlevGL normally runs from the refresh timer
+              // or from request_refresh(), the tick is only a safety net while idle
 
+              refresh_timer_queue(ExpiredQueue::create(2, *this, *this)),
+              refresh_timer(Timer::create(RefreshTimerId, refresh_timer_queue, false, milliseconds(LV_DISP_DEF_REFR_PERIOD))),
               view_controller(*this)
     {
     }
@@ -42,12 +49,95 @@ namespace redstone
     {
         Log::info(TAG, "initializing LvglTask");
         view_controller.init();
+        minute_start = steady_clock::now();
+        request_refresh();
     }
 
-    // The task tick event that happens every 100ms
+    // The task tick event that happens every 10 seconds
     void LvglTask::tick()
     {
-        // Let LittlevGL do some work
-        lv_task_handler();
+        run_lvgl();
+    }
+
+    // The refresh timer expired, LittlevGL has a task due
+    void LvglTask::event(const TimerExpiredEvent& event)
+    {
+        run_lvgl();
+    }
+
+    // Run LittlevGL on the next pass through the task loop
+    void LvglTask::request_refresh()
+    {
+        refresh_timer->start(milliseconds(1));
+    }
+
+    // Let LittlevGL do some work and sleep until its next deadline, or until an
+    // external event (EnvirValue, button) if nothing on screen is changing
+    void LvglTask::run_lvgl()
+    {
+        count_wakeup();
+
+        uint32_t time_till_next;
+
+        {
+            ScopedTiming timing(TimingStats::LvglTaskHandler);
+            time_till_next = lv_task_handler();
+        }
+
+        if (is_lvgl_idle())
+        {
+            refresh_timer->stop();
+        }
+        else
+        {
+            refresh_timer->start(milliseconds(std::max(time_till_next, static_cast<uint32_t>(1))));
+        }
+    }
+
+    // LittlevGL is idle when nothing is waiting to be redrawn, nothing is animating, no
+    // button edge is waiting to be read and no input device is being pressed
+    bool LvglTask::is_lvgl_idle()
+    {
+        if (view_controller.has_pending_input())
+        {
+            return false;
+        }
+
+        lv_disp_t* disp = lv_disp_get_default();
+
+        if (disp != nullptr && disp->inv_p > 0)
+        {
+            return false;
+        }
+
+        if (lv_anim_count_running() > 0)
+        {
+            return false;
+        }
+
+        for (lv_indev_t* indev = lv_indev_get_next(nullptr); indev != nullptr; indev = lv_indev_get_next(indev))
+        {
+            if (indev->proc.state == LV_INDEV_STATE_PR)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Count the LittlevGL runs in a minute
+    void LvglTask::count_wakeup()
+    {
+        wakeups_this_minute++;
+
+        auto now = steady_clock::now();
+
+        if (now - minute_start >= minutes(1))
+        {
+            wakeups_per_minute = wakeups_this_minute;
+            wakeups_this_minute = 0;
+            minute_start = now;
+        }
     }
 }
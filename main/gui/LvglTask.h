@@ -16,12 +16,19 @@
  ***************************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include "gui/ViewController.h"
 #include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/TaskEventQueue.h>
+#include <smooth/core/timer/Timer.h>
+#include <smooth/core/timer/TimerExpiredEvent.h>
 
 namespace redstone
 {
-    class LvglTask : public smooth::core::Task
+    class LvglTask : public smooth::core::Task,
+                     public smooth::core::ipc::IEventListener<smooth::core::timer::TimerExpiredEvent>
     {
         public:
             LvglTask();
@@ -30,7 +37,45 @@ namespace redstone
 
             void tick() override;
 
+            /// The refresh timer expired event, LittlevGL has work due
+            void event(const smooth::core::timer::TimerExpiredEvent& event) override;
+
+            /// Request LittlevGL to run as soon as possible, used when something on screen changed
+            /// Must be called from this task, i.e. from an event handler running under LvglTask
+            void request_refresh();
+
+            /// Get the number of times LittlevGL ran during the last full minute
+            /// \return Returns the wakeups per minute
+            uint32_t get_wakeups_per_minute() const
+            {
+                return wakeups_per_minute;
+            }
+
+            /// Get the view controller and its counters
+            const ViewController& get_view_controller() const
+            {
+                return view_controller;
+            }
+
         private:
+            /// Run the LittlevGL task handler and schedule the next run
+            void run_lvgl();
+
+            /// Check if LittlevGL has nothing to do until an external event happens
+            /// \return Returns true when no areas are invalid, no animations are running and no input is pressed
+            bool is_lvgl_idle();
+
+            /// Count a wakeup and roll the count over every minute
+            void count_wakeup();
+
+            using ExpiredQueue = smooth::core::ipc::TaskEventQueue<smooth::core::timer::TimerExpiredEvent>;
+            std::shared_ptr<ExpiredQueue> refresh_timer_queue;
+            smooth::core::timer::TimerOwner refresh_timer;
+
             ViewController view_controller;
+
+            std::chrono::steady_clock::time_point minute_start{};
+            uint32_t wakeups_this_minute{ 0 };
+            std::atomic<uint32_t> wakeups_per_minute{ 0 };
     };
 }
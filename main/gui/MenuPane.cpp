@@ -14,9 +14,17 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
+#include <algorithm>
 #include "gui/MenuPane.h"
+#include "gui/LvglTask.h"
+#include "gui/DisplayDriver.h"
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
+#include <esp_timer.h>
+#include <smooth/core/ipc/Publisher.h>
 #include <smooth/core/logging/log.h>
 
+using namespace smooth::core::ipc;
 using namespace smooth::core::logging;
 
 namespace redstone
@@ -29,10 +37,17 @@ namespace redstone
     {
     }
 
-    // Initialize the lv input device driver - handles button debounce and causes
+    // Initialize the lv input device driver - reads the debounced button edges and causes
     // gui button to display the pressed style when the hardware button is pressed
-    void MenuPane::initialize()
+    void MenuPane::initialize(LvglTask& task_lvgl, DisplayDriver& display_driver)
     {
+        this->task_lvgl = &task_lvgl;
+        this->display_driver = &display_driver;
+
+        // Create an interrupt queue for the debounced hardware button edges, an edge wakes
+        // LvglTask since LittlevGL does not read the buttons while it is idle
+        button_queue = ButtonQueue::create(task_lvgl, *this);
+
         lv_indev_drv_init(&input_device_driver);
         input_device_driver.read_cb = button_read_cb;
         input_device_driver.type = LV_INDEV_TYPE_BUTTON;
@@ -72,7 +87,7 @@ namespace redstone
     // Add a menu button - A menu button consist of a gui button and a hardware button.
     // Pressing the hardware button cause the gui button to display being pressed and
     // create an on-clicked event when the pressed harware button is released.  The
-    // debounce of the hardware button is handled in lv_indev_drv
+    // debounce of the hardware button is handled in the HwPushButton interrupt
     void MenuPane::add_menu_button(BtnID id, std::unique_ptr<GuiButton> gui_btn, std::unique_ptr<HwPushButton> hw_btn)
     {
         gui_buttons[id] = std::move(gui_btn);
@@ -94,42 +109,80 @@ namespace redstone
         return (end_point - start_point) / 2 + start_point;
     }
 
-    // Read the hardware buttons and get id of button if pressed, used by Lvgl
-    int MenuPane::read_hardware_buttons()
+    // A debounced hardware button edge from the button interrupt
+    void MenuPane::event(const HwButtonEdge& event)
     {
-        for (auto const& x:hw_buttons)
+        ScopedTiming timing(TimingStats::MenuPaneEvent);
+        TraceRing::record(TraceEventType::QueueReceive, 1);
+
+        uint8_t next_head = static_cast<uint8_t>((edge_ring_head + 1) % EdgeRingSize);
+
+        // When the ring is full the oldest edge is dropped, the latest edges matter most
+        if (next_head == edge_ring_tail)
         {
-            if (x.second->is_button_pressed())
-            {
-                return x.first;
-            }
+            edge_ring_tail = static_cast<uint8_t>((edge_ring_tail + 1) % EdgeRingSize);
         }
 
-        return NoButtonPressed;
+        edge_ring[edge_ring_head] = event;
+        edge_ring_head = next_head;
+
+        // The input driver is read by its own Lvgl task every LV_INDEV_DEF_READ_PERIOD, make
+        // it due now or an edge within that period of the last read waits for the next one
+        lv_task_ready(input_device_button->driver.read_task);
+        task_lvgl->request_refresh();
     }
 
-    // Button read callback for the Lvgl input driver
-    bool MenuPane::button_read_cb(lv_indev_drv_t* input_device_driver, lv_indev_data_t* data)
+    // Read the next buffered edge - each edge is reported to Lvgl so a press and release
+    // that both happen between two reads still produce a click
+    bool MenuPane::read_button_edges(lv_indev_data_t* data)
     {
-        uint8_t last_button = 0;
-        MenuPane* driver = reinterpret_cast<MenuPane*>(input_device_driver->user_data);
-        int button_pressed = driver->read_hardware_buttons();
-
-        if (button_pressed >= 0)
+        if (edge_ring_tail != edge_ring_head)
         {
-            data->state = LV_INDEV_STATE_PR;
-            last_button = button_pressed;
+            const HwButtonEdge& edge = edge_ring[edge_ring_tail];
+            edge_ring_tail = static_cast<uint8_t>((edge_ring_tail + 1) % EdgeRingSize);
+
+            last_pressed = edge.is_pressed();
+            last_button = edge.get_btn_id();
+
+            if (last_pressed)
+            {
+                last_press_latency_us = esp_timer_get_time() - edge.get_time_us();
+                max_press_latency_us = std::max(max_press_latency_us, last_press_latency_us);
+                press_time_us = edge.get_time_us();
+
+                // the press ends when the pressed button is out on the display
+                display_driver->begin_frame(TimingStats::ButtonPressRedraw, edge.get_time_us());
+            }
+            else if (edge.get_time_us() - press_time_us >= TraceDumpPressUs)
+            {
+                // a long press asks for a trace dump instead of clicking the button
+                if (gui_buttons.count(last_button) > 0)
+                {
+                    gui_buttons[last_button]->suppress_click();
+                }
+
+                Publisher<TraceDumpRequest>::publish(TraceDumpRequest{});
+            }
         }
-        else
+        else if (last_pressed && hw_buttons[last_button])
         {
-            data->state = LV_INDEV_STATE_REL;
+            // A release edge can be lost inside a debounce window, LvglTask keeps reading
+            // while a button is pressed so check the pin itself
+            last_pressed = hw_buttons[last_button]->resync();
         }
 
-        // Save the last pressed button's ID
-        data->btn_id = last_button;
+        data->state = last_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+        data->btn_id = static_cast<uint32_t>(last_button);
 
-        // Return `false` because we are not buffering and no more data to read
-        return false;
+        // Return `true` while buffered edges remain so Lvgl reads again right away
+        return edge_ring_tail != edge_ring_head;
+    }
+
+    // Button read callback for the Lvgl input driver
+    bool MenuPane::button_read_cb(lv_indev_drv_t* input_device_driver, lv_indev_data_t* data)
+    {
+        MenuPane* driver = reinterpret_cast<MenuPane*>(input_device_driver->user_data);
+        return driver->read_button_edges(data);
     }
 
     // Show the menu pane
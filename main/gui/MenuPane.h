@@ -20,13 +20,19 @@
 #include <unordered_map>
 #include <memory>               // for unique_ptr
 #include <lvgl/lvgl.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/ISRTaskEventQueue.h>
 #include "gui/IPane.h"
 #include "gui/GuiButton.h"
+#include "gui/HwButtonEdge.h"
 #include "gui/HwPushButton.h"
 
 namespace redstone
 {
-    class MenuPane : public IPane
+    class LvglTask;
+    class DisplayDriver;
+
+    class MenuPane : public IPane, public smooth::core::ipc::IEventListener<HwButtonEdge>
     {
         public:
             // Constants & Enums
@@ -37,12 +43,52 @@ namespace redstone
 
             static int constexpr ButtonQtyMax = 3;
             static int constexpr NoButtonPressed = -1;
+            static int constexpr ButtonQueueSize = 5;
+            static int constexpr EdgeRingSize = 8;
+            static int64_t constexpr TraceDumpPressUs = 3 * 1000 * 1000;      // hold 3 sec to dump the trace
+
+            using ButtonQueue = smooth::core::ipc::ISRTaskEventQueue<HwButtonEdge, ButtonQueueSize>;
 
             /// Constructor
             MenuPane();
 
             /// Initialize the LV Input Device Driver
-            void initialize();
+            /// \param task_lvgl The task this class is running under
+            /// \param display_driver The display driver, times a button press until it is redrawn
+            void initialize(LvglTask& task_lvgl, DisplayDriver& display_driver);
+
+            /// Get the queue the hardware buttons signal from their interrupt, it lives as long
+            /// as the menu pane and the buttons are destroyed before it
+            /// \return Returns the button interrupt queue
+            ButtonQueue* get_button_queue()
+            {
+                return button_queue.get();
+            }
+
+            /// The debounced hardware button edge event, buffers the edge for the Lvgl input
+            /// driver and wakes LittlevGL so the edge is read
+            void event(const HwButtonEdge& event) override;
+
+            /// Check if debounced edges are waiting to be read by the Lvgl input driver
+            bool has_buffered_edges() const
+            {
+                return edge_ring_tail != edge_ring_head;
+            }
+
+            /// Get the time from the last button press edge until the Lvgl input driver read it, the
+            /// time until the pressed button is on the display is the "button press redraw" probe
+            /// \return Returns the latency in microseconds
+            int64_t get_last_press_latency_us() const
+            {
+                return last_press_latency_us;
+            }
+
+            /// Get the longest time from a button press edge until the Lvgl input driver read it
+            /// \return Returns the latency in microseconds
+            int64_t get_max_press_latency_us() const
+            {
+                return max_press_latency_us;
+            }
 
             /// Create the Menu Pane
             /// \param menu_btns An object that contains the gui menu buttons used in menu pane
@@ -74,8 +120,10 @@ namespace redstone
             /// \param data The data from the input driver
             static bool button_read_cb(lv_indev_drv_t* input_device_driver, lv_indev_data_t* data);
 
-            /// Read the hardware buttons to see if one is pressed
-            int read_hardware_buttons();
+            /// Read the next buffered button edge, or the current button state if no edges are buffered
+            /// \param data The data for the Lvgl input driver
+            /// \return Returns true if more edges are buffered
+            bool read_button_edges(lv_indev_data_t* data);
 
             /// Get the middle point between to points
             /// \param start_point The starting point
@@ -83,12 +131,28 @@ namespace redstone
             /// \return Return the middle between the start point and end poit
             lv_coord_t get_mid_point(lv_coord_t start_point, lv_coord_t end_point);
 
+            LvglTask* task_lvgl{ nullptr };
+            DisplayDriver* display_driver{ nullptr };
+            std::shared_ptr<ButtonQueue> button_queue;
+
             lv_indev_drv_t input_device_driver;
             lv_indev_t* input_device_button;
             lv_style_t menu_style;
             lv_obj_t* menu_pane_container;
 
-            std::unordered_map<int, std::unique_ptr<HwPushButton>> hw_buttons;
+            // Debounced edges waiting to be read by the Lvgl input driver
+            std::array<HwButtonEdge, EdgeRingSize> edge_ring{};
+            uint8_t edge_ring_head{ 0 };
+            uint8_t edge_ring_tail{ 0 };
+
+            bool last_pressed{ false };
+            int last_button{ 0 };
+            int64_t last_press_latency_us{ 0 };
+            int64_t max_press_latency_us{ 0 };
+            int64_t press_time_us{ 0 };
+
+            // Declared after button_queue so the button interrupts are removed before the queue goes
+            std::array<std::unique_ptr<HwPushButton>, ButtonQtyMax> hw_buttons{};
             std::unordered_map<int, std::unique_ptr<GuiButton>> gui_buttons;
             std::array<lv_point_t, ButtonQtyMax> screen_locations_of_buttons;
     };
@@ -0,0 +1,117 @@
+/****************************************************************************************
+ * SH1107FrameBuffer.h - An in-memory copy of the SH1107 display ram in page layout
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+namespace redstone
+{
+    // This class has no ESP-IDF, Smooth or LittlevGL dependencies so it can be compiled
+    // on any platform to inspect what the display is showing.
+    class SH1107FrameBuffer
+    {
+        public:
+            static constexpr int Columns = 64;
+            static constexpr int Pages = 16;
+            static constexpr int Size = Columns * Pages;
+
+            /// Clear all pixels
+            void clear()
+            {
+                ram.fill(0);
+            }
+
+            /// Update a span of columns in a page and find the part that changed
+            /// \param page The page number to update
+            /// \param start_col The first column of the span
+            /// \param end_col The last column of the span
+            /// \param data The new pixel data for start_col through end_col
+            /// \param first_dirty Returns the first column that changed
+            /// \param length Returns the number of columns from first_dirty to the last column that changed
+            /// \return Returns true if any column changed
+            bool update_page(int page, int start_col, int end_col, const uint8_t* data,
+                             int& first_dirty, size_t& length)
+            {
+                uint8_t* page_ram = &ram[page * Columns];
+                int last_dirty = -1;
+                first_dirty = -1;
+
+                for (int col = start_col; col <= end_col; col++)
+                {
+                    if (page_ram[col] != data[col - start_col])
+                    {
+                        first_dirty = first_dirty < 0 ? col : first_dirty;
+                        last_dirty = col;
+                    }
+                }
+
+                length = 0;
+
+                if (first_dirty >= 0)
+                {
+                    length = static_cast<size_t>(last_dirty - first_dirty + 1);
+
+                    for (size_t i = 0; i < length; i++)
+                    {
+                        page_ram[first_dirty + i] = data[first_dirty - start_col + i];
+                    }
+                }
+
+                return length > 0;
+            }
+
+            /// Get a pixel using the SH1107 column and row
+            /// \param column The column (segment) of the pixel
+            /// \param row The row (common) of the pixel, page = row / 8
+            /// \return Returns true if the pixel is lit
+            bool get_pixel(int column, int row) const
+            {
+                return (ram[column + Columns * (row >> 3)] >> (row & 0x07)) & 0x01;
+            }
+
+            /// Get the display ram bytes
+            const std::array<uint8_t, Size>& data() const
+            {
+                return ram;
+            }
+
+            /// Write the frame buffer as a binary PBM (P4) image
+            /// \param out The stream to write the image to
+            /// \param landscape When true the image is 128 wide by 64 high, otherwise 64 wide by 128 high
+            void write_pbm(std::ostream& out, bool landscape) const
+            {
+                int width = landscape ? Pages * 8 : Columns;
+                int height = landscape ? Columns : Pages * 8;
+
+                out << "P4\n" << width << " " << height << "\n";
+
+                for (int y = 0; y < height; y++)
+                {
+                    uint8_t packed = 0;
+
+                    for (int x = 0; x < width; x++)
+                    {
+                        bool lit = landscape ? get_pixel(y, x) : get_pixel(x, y);
+                        packed = static_cast<uint8_t>((packed << 1) | (lit ? 1 : 0));
+
+                        if ((x & 0x07) == 0x07)
+                        {
+                            out.put(static_cast<char>(packed));
+                            packed = 0;
+                        }
+                    }
+                }
+            }
+
+        private:
+            std::array<uint8_t, Size> ram{};
+    };
+}
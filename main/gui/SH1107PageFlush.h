@@ -0,0 +1,124 @@
+/****************************************************************************************
+ * SH1107PageFlush.h - Prepares the SH1107 page transfers of a flushed area
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "gui/SH1107FrameBuffer.h"
+
+namespace redstone
+{
+    // Only the span of each page from the first to the last column that differs from the
+    // shadow frame buffer is sent, as a command transaction that sets the page and column
+    // address followed by a data transaction.  The device only has to provide prepare_cmds()
+    // and prepare_data(), so this has no ESP-IDF, Smooth or LittlevGL dependencies either
+    // and the transfers of a flush can be checked on any platform.
+    template<typename Device>
+    class SH1107PageFlush
+    {
+        public:
+            static constexpr int Columns = SH1107FrameBuffer::Columns;
+            static constexpr int Pages = SH1107FrameBuffer::Pages;
+
+            // Each page has its own slot of page commands, the commands of one flush are all
+            // prepared before any of them are sent
+            static constexpr int CmdSlotLen = 4;
+            static constexpr int CmdBufferLen = Pages * CmdSlotLen;
+
+            /// Constructor
+            /// \param device The device the transfers are prepared on
+            /// \param page_commands A buffer of CmdBufferLen bytes the device can send from
+            SH1107PageFlush(Device& device, uint8_t* page_commands) : device(device), page_commands(page_commands)
+            {
+            }
+
+            /// Prepare the transfers of the columns of an area that differ from the shadow frame
+            /// buffer and update it
+            /// \param start_page The first page of the area
+            /// \param end_page The last page of the area
+            /// \param start_col The first column of the area
+            /// \param end_col The last column of the area
+            /// \param data The pixel data of the area, page after page with a stride of Columns
+            /// \return Returns false if the device had no room for a transfer
+            bool prepare_area(int start_page, int end_page, int start_col, int end_col, const uint8_t* data)
+            {
+                bool res = true;
+
+                for (int page = start_page; page <= end_page; page++)
+                {
+                    int first_dirty;
+                    size_t length;
+
+                    if (shadow_frame_buffer.update_page(page, start_col, end_col, data, first_dirty, length))
+                    {
+                        res &= prepare_page(page, first_dirty, &data[first_dirty - start_col], length);
+                    }
+
+                    data += Columns;
+                }
+
+                return res;
+            }
+
+            /// Prepare the transfers that blank the whole display ram and clear the shadow frame
+            /// buffer, so the two start out the same
+            /// \param zeros A page of zero bytes the device can send from
+            /// \return Returns false if the device had no room for a transfer
+            bool prepare_clear(const uint8_t* zeros)
+            {
+                bool res = true;
+                shadow_frame_buffer.clear();
+
+                for (int page = 0; page < Pages; page++)
+                {
+                    res &= prepare_page(page, 0, zeros, Columns);
+                }
+
+                return res;
+            }
+
+            /// Get the number of transactions prepared
+            /// \return Returns the count of command and data transactions since power up
+            uint32_t get_transaction_count() const
+            {
+                return transactions;
+            }
+
+            /// Get the shadow frame buffer
+            /// \return Returns the copy of what the SH1107 display ram is currently showing
+            const SH1107FrameBuffer& get_frame_buffer() const
+            {
+                return shadow_frame_buffer;
+            }
+
+        private:
+            // The SH1107 page addressing commands, the values of SH1107Cmd in Smooth
+            static constexpr uint8_t LowerColumnAddress = 0x00;
+            static constexpr uint8_t UpperColumnAddress = 0x10;
+            static constexpr uint8_t PageAddress0 = 0xB0;
+
+            // To send a page of pixel data the upper and the lower column address bits and the
+            // page address are set before the pixel data itself is sent
+            bool prepare_page(int page, int start_col, const uint8_t* data, size_t length)
+            {
+                uint8_t* cmds = &page_commands[page * CmdSlotLen];
+                cmds[0] = static_cast<uint8_t>(UpperColumnAddress | ((start_col >> 4) & 0x0F));
+                cmds[1] = static_cast<uint8_t>(LowerColumnAddress | (start_col & 0x0F));
+                cmds[2] = static_cast<uint8_t>(PageAddress0 | page);
+
+                transactions += 2;
+
+                return device.prepare_cmds(cmds, 3) && device.prepare_data(data, length);
+            }
+
+            Device& device;
+            uint8_t* page_commands;
+            SH1107FrameBuffer shadow_frame_buffer{};
+            uint32_t transactions{ 0 };
+    };
+}
@@ -0,0 +1,210 @@
+/****************************************************************************************
+ * SH1107Spi.cpp - An SPI device for the SH1107 that queues DMA transactions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#include "gui/SH1107Spi.h"
+#include <thread>
+#include <esp_attr.h>
+#include <hal/cpu_hal.h>
+#include <smooth/core/logging/log.h>
+#include "stats/TimingStats.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class Constants
+    static const char* TAG = "SH1107Spi";
+
+    // Constructor
+    SH1107Spi::SH1107Spi(gpio_num_t chip_select, gpio_num_t data_command, gpio_num_t reset, int clock_hz)
+            : chip_select(chip_select), data_command(data_command), reset(reset), clock_hz(clock_hz)
+    {
+    }
+
+    // Destructor
+    SH1107Spi::~SH1107Spi()
+    {
+        if (handle != nullptr)
+        {
+            collect_results();
+            spi_bus_remove_device(handle);
+        }
+    }
+
+    // Configure the D/C and reset pins and add the device to the bus
+    bool SH1107Spi::initialize(spi_host_device_t host)
+    {
+        gpio_config_t config{};
+        config.pin_bit_mask = (1ULL << data_command) | (1ULL << reset);
+        config.mode = GPIO_MODE_OUTPUT;
+        config.pull_up_en = GPIO_PULLUP_DISABLE;
+        config.pull_down_en = GPIO_PULLDOWN_DISABLE;
+        config.intr_type = GPIO_INTR_DISABLE;
+        gpio_config(&config);
+        gpio_set_level(reset, 1);
+
+        spi_device_interface_config_t device_config{};
+        device_config.mode = 0;
+        device_config.duty_cycle_pos = 128;
+        device_config.clock_speed_hz = clock_hz;
+        device_config.spics_io_num = chip_select;
+        device_config.queue_size = QueueSize;
+        device_config.pre_cb = pre_transaction_cb;
+        device_config.post_cb = post_transaction_cb;
+
+        esp_err_t res = spi_bus_add_device(host, &device_config, &handle);
+
+        if (res != ESP_OK)
+        {
+            Log::error(TAG, "Adding the SH1107 to the SPI bus failed: {}", esp_err_to_name(res));
+            handle = nullptr;
+        }
+
+        return res == ESP_OK;
+    }
+
+    // Pulse the reset pin
+    void SH1107Spi::hw_reset(std::chrono::milliseconds reset_time, std::chrono::milliseconds wait_time)
+    {
+        gpio_set_level(reset, 0);
+        std::this_thread::sleep_for(reset_time);
+        gpio_set_level(reset, 1);
+        std::this_thread::sleep_for(wait_time);
+    }
+
+    // Send a command and wait for it to complete
+    bool SH1107Spi::send_cmd(uint8_t cmd)
+    {
+        return send_cmds(&cmd, 1);
+    }
+
+    // Send commands with a polling transaction, the queue has to be empty for that
+    bool SH1107Spi::send_cmds(const uint8_t* cmds, size_t length)
+    {
+        collect_results();
+
+        Transaction transaction{};
+        transaction.trans.length = length * 8;
+        transaction.trans.tx_buffer = cmds;
+        transaction.device = this;
+
+        bool res = handle != nullptr && spi_device_polling_transmit(handle, &transaction.trans) == ESP_OK;
+        errors += res ? 0 : 1;
+
+        return res;
+    }
+
+    // Fill in the next descriptor of the batch, nothing is queued yet.  The descriptors of
+    // the previous batch are taken back first, normally they are all complete by now.
+    bool SH1107Spi::prepare(const uint8_t* buffer, size_t length, uint32_t flags)
+    {
+        collect_results();
+
+        if (prepared == transactions.size())
+        {
+            errors++;
+            return false;
+        }
+
+        Transaction& transaction = transactions[prepared++];
+        transaction.trans = spi_transaction_t{};
+        transaction.trans.length = length * 8;
+        transaction.trans.tx_buffer = buffer;
+        transaction.device = this;
+        transaction.flags = flags;
+
+        return true;
+    }
+
+    // Queue the prepared descriptors back to back, the queue holds a whole batch so this
+    // never waits for the bus
+    bool SH1107Spi::submit(bool signal_done)
+    {
+        if (handle == nullptr || prepared == 0)
+        {
+            prepared = 0;
+            return false;
+        }
+
+        transactions[0].flags |= FirstFlag;
+        transactions[prepared - 1].flags |= signal_done ? SignalDoneFlag : 0;
+
+        bool res = true;
+
+        for (size_t i = 0; i < prepared && res; i++)
+        {
+            res = spi_device_queue_trans(handle, &transactions[i].trans, portMAX_DELAY) == ESP_OK;
+            in_flight += res ? 1 : 0;
+        }
+
+        prepared = 0;
+
+        if (!res)
+        {
+            // the done callback will not be called, wait for what was queued so the caller can
+            // hand the buffers back itself
+            errors++;
+            collect_results();
+        }
+
+        return res;
+    }
+
+    // Take back the descriptors of the last batch, once per batch
+    bool SH1107Spi::collect_results()
+    {
+        bool res = true;
+
+        while (in_flight > 0)
+        {
+            spi_transaction_t* done;
+
+            if (spi_device_get_trans_result(handle, &done, portMAX_DELAY) != ESP_OK)
+            {
+                errors++;
+                res = false;
+                break;
+            }
+
+            in_flight--;
+        }
+
+        return res;
+    }
+
+    // Runs in the SPI interrupt, D/C is high for pixel data and low for commands.  The time
+    // since the previous transaction of the batch ended is time the bus sat idle.
+    void IRAM_ATTR SH1107Spi::pre_transaction_cb(spi_transaction_t* trans)
+    {
+        auto transaction = reinterpret_cast<Transaction*>(trans);
+        SH1107Spi* device = transaction->device;
+        gpio_set_level(device->data_command, transaction->flags & DataFlag);
+
+        if (!(transaction->flags & FirstFlag) && device->in_flight > 0)
+        {
+            TimingStats::instance().record(TimingStats::SpiBusGap, cpu_hal_get_cycle_count() - device->last_end_cycles);
+        }
+    }
+
+    // Runs in the SPI interrupt after the last byte of a transaction is out
+    void IRAM_ATTR SH1107Spi::post_transaction_cb(spi_transaction_t* trans)
+    {
+        auto transaction = reinterpret_cast<Transaction*>(trans);
+        SH1107Spi* device = transaction->device;
+        device->last_end_cycles = cpu_hal_get_cycle_count();
+
+        if ((transaction->flags & SignalDoneFlag) && device->done_callback != nullptr)
+        {
+            device->done_callback(device->done_context);
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/****************************************************************************************
+ * SH1107Spi.h - An SPI device for the SH1107 that queues DMA transactions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+
+namespace redstone
+{
+    // The LCDSpi device of Smooth waits for each transaction to finish.  This device sends a
+    // batch of transactions instead: all descriptors of a batch are prepared first and then
+    // queued back to back, so the SPI interrupt always finds the next transaction waiting and
+    // the caller can go on while the DMA sends the data.  The D/C line is set by the
+    // pre-transaction callback from the type of each transaction.  The post-transaction
+    // callback of the last transaction calls the done callback, i.e. from the SPI interrupt,
+    // and the results of the whole batch are collected once, before the next batch.
+    //
+    // The command and data buffers of a batch must be DMA capable and must stay unchanged
+    // until the done callback is called.
+    class SH1107Spi
+    {
+        public:
+            /// The completion callback, called from the SPI interrupt
+            using DoneCallback = void (*)(void* context);
+
+            // A flush of all 16 pages is a command and a data transaction per page, so 32
+            // descriptors let the largest flush be queued without waiting for a free slot
+            static constexpr int QueueSize = 32;
+
+            /// Constructor
+            /// \param chip_select The chip select gpio pin
+            /// \param data_command The data/command gpio pin, low for a command
+            /// \param reset The reset gpio pin, active low
+            /// \param clock_hz The SPI clock
+            SH1107Spi(gpio_num_t chip_select, gpio_num_t data_command, gpio_num_t reset, int clock_hz);
+
+            /// Destructor
+            ~SH1107Spi();
+
+            /// Add the device to an initialized SPI bus
+            /// \param host The SPI host of the bus
+            /// \return Returns true if successful
+            bool initialize(spi_host_device_t host);
+
+            /// Set the function that is called when a transaction queued with signal_done completes
+            /// \param callback The function, it runs in the SPI interrupt
+            /// \param context The argument for the function
+            void set_done_callback(DoneCallback callback, void* context)
+            {
+                done_callback = callback;
+                done_context = context;
+            }
+
+            /// Pulse the reset pin
+            /// \param reset_time How long the reset pin is held low
+            /// \param wait_time How long to wait after the reset for the chip to start up
+            void hw_reset(std::chrono::milliseconds reset_time, std::chrono::milliseconds wait_time);
+
+            /// Send a command and wait for it to complete
+            /// \param cmd The command
+            /// \return Returns true if successful
+            bool send_cmd(uint8_t cmd);
+
+            /// Send commands and wait for them to complete
+            /// \param cmds The commands
+            /// \param length The number of command bytes
+            /// \return Returns true if successful
+            bool send_cmds(const uint8_t* cmds, size_t length);
+
+            /// Add commands to the next batch
+            /// \param cmds The commands, DMA capable
+            /// \param length The number of command bytes
+            /// \return Returns true if there was room in the batch
+            bool prepare_cmds(const uint8_t* cmds, size_t length)
+            {
+                return prepare(cmds, length, 0);
+            }
+
+            /// Add pixel data to the next batch
+            /// \param data The pixel data, DMA capable
+            /// \param length The number of data bytes
+            /// \return Returns true if there was room in the batch
+            bool prepare_data(const uint8_t* data, size_t length)
+            {
+                return prepare(data, length, DataFlag);
+            }
+
+            /// Queue the prepared batch back to back without waiting
+            /// \param signal_done When true the done callback is called once the last transaction is out
+            /// \return Returns true if a batch was queued, false if nothing was prepared or queueing failed
+            bool submit(bool signal_done);
+
+            /// Wait for the transactions of the last batch and take back their descriptors
+            /// \return Returns true if all transactions succeeded
+            bool collect_results();
+
+            /// Get the number of transactions that could not be queued or failed
+            uint32_t get_error_count() const
+            {
+                return errors;
+            }
+
+        private:
+            // The flags of a transaction, kept next to the IDF descriptor
+            static constexpr uint32_t DataFlag = 0x01;
+            static constexpr uint32_t SignalDoneFlag = 0x02;
+            static constexpr uint32_t FirstFlag = 0x04;
+
+            // The IDF descriptor is the first member so the callbacks can cast back to it
+            struct Transaction
+            {
+                spi_transaction_t trans;
+                SH1107Spi* device;
+                uint32_t flags;
+            };
+
+            /// Prepare the descriptor of a transaction of the next batch
+            bool prepare(const uint8_t* buffer, size_t length, uint32_t flags);
+
+            /// Set the D/C line before a transaction starts and time the bus gap since the
+            /// previous transaction of the batch
+            static void pre_transaction_cb(spi_transaction_t* trans);
+
+            /// Call the done callback after the last transaction of a batch
+            static void post_transaction_cb(spi_transaction_t* trans);
+
+            gpio_num_t chip_select;
+            gpio_num_t data_command;
+            gpio_num_t reset;
+            int clock_hz;
+
+            spi_device_handle_t handle{ nullptr };
+            std::array<Transaction, QueueSize> transactions{};
+            size_t prepared{ 0 };
+            size_t in_flight{ 0 };
+            uint32_t errors{ 0 };
+
+            // Written by the SPI interrupt, the cycle count when the previous transaction ended
+            uint32_t last_end_cycles{ 0 };
+
+            DoneCallback done_callback{ nullptr };
+            void* done_context{ nullptr };
+    };
+}
@@ -15,6 +15,7 @@
  * Licensed under MIT License
  ***************************************************************************************/
 #include "gui/ViewController.h"
+#include "gui/LvglTask.h"
 #include "gui/GuiButtonNext.h"
 #include "gui/HwPushButton.h"
 #include "gui/TitlePane.h"
@@ -22,6 +23,9 @@
 #include "gui/CPHumidity.h"
 #include "gui/CPHeatIndex.h"
 #include "gui/CPDewPoint.h"
+#include "gui/CPTrend.h"
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
 
 #include <smooth/core/logging/log.h>
 
@@ -33,8 +37,17 @@ namespace redstone
     static const char* TAG = "ViewController";
 
     // Constructor
-    ViewController::ViewController(smooth::core::Task& task_lvgl) : 
-                                   task_lvgl(task_lvgl)
+    ViewController::ViewController(LvglTask& task_lvgl) : 
+                                   task_lvgl(task_lvgl),
+                                   subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this)),
+                                   subr_queue_record(SubQRecord::create(2, task_lvgl, *this))
+
+            // Create Subscriber Queue (SubQ) so the view controller can listen for
+            // EnvirValue events and hand them to the visible content pane
+            // the queue will hold up to 2 items
+            // the "task_lvgl" is this task which to signal when an event is available.
+            // the "*this" is the class instance that will receive the events
+            // The recorded samples come from a second queue, one every 30 sec
     {
     }
 
@@ -62,28 +75,38 @@ namespace redstone
         title_pane = std::make_unique<TitlePane>("DHT12 DewPoint");
         title_pane->create(LV_HOR_RES, 20);
         title_panes[DewPoint] = std::move(title_pane);
+
+        title_pane = std::make_unique<TitlePane>("DHT12 Trend");
+        title_pane->create(LV_HOR_RES, 20);
+        title_panes[Trend] = std::move(title_pane);
     
         // create content panes
-        content_pane = std::make_unique<CPTemperature>(task_lvgl);
+        content_pane = std::make_unique<CPTemperature>();
         //content_pane->create(LV_HOR_RES, 22);
         content_pane->create(LV_HOR_RES, 22);
         content_panes[Temperature] = std::move(content_pane);
     
-        content_pane = std::make_unique<CPHumidity>(task_lvgl);
+        content_pane = std::make_unique<CPHumidity>();
         content_pane->create(LV_HOR_RES, 22);
         content_panes[Humidity] = std::move(content_pane);
 
-        content_pane = std::make_unique<CPHeatIndex>(task_lvgl);
+        content_pane = std::make_unique<CPHeatIndex>();
         content_pane->create(LV_HOR_RES, 22);
         content_panes[HeatIndex] = std::move(content_pane);
 
-        content_pane = std::make_unique<CPDewPoint>(task_lvgl);
+        content_pane = std::make_unique<CPDewPoint>();
         content_pane->create(LV_HOR_RES, 22);
         content_panes[DewPoint] = std::move(content_pane);
+
+        auto trend = std::make_unique<CPTrend>();
+        trend->create(LV_HOR_RES, 22);
+        trend_pane = trend.get();
+        content_panes[Trend] = std::move(trend);
     
         // create menu pane
-        menu_pane.initialize();
-        menu_pane.add_menu_button(MenuPane::Button35, std::make_unique<GuiButtonNext>(*this), std::make_unique<HwPushButton>(GPIO_NUM_35, false, false));
+        menu_pane.initialize(task_lvgl, display_driver);
+        menu_pane.add_menu_button(MenuPane::Button35, std::make_unique<GuiButtonNext>(*this),
+                                  std::make_unique<HwPushButton>(MenuPane::Button35, GPIO_NUM_35, false, false, menu_pane.get_button_queue()));
         menu_pane.create(LV_HOR_RES, 20);
         menu_pane.show();  // only need to do this once since we never change the menu pane
 
@@ -93,6 +116,7 @@ namespace redstone
 
     void ViewController::show_new_view()
     {
+        update_content_pane(new_view_id);
         title_panes[new_view_id]->show();
         content_panes[new_view_id]->show();
         current_view_id = new_view_id;
@@ -106,9 +130,54 @@ namespace redstone
 
     void ViewController::show_next_view()
     {
+        display_driver.begin_frame();
         hide_current_view();
-        new_view_id = current_view_id == DewPoint ? Temperature : static_cast<ViewID>(static_cast<int>(current_view_id) + 1);
+        new_view_id = current_view_id == Trend ? Temperature : static_cast<ViewID>(static_cast<int>(current_view_id) + 1);
         show_new_view();
     }
 
+    // The published EnvirValue event - only the visible content pane is updated now,
+    // hidden content panes are updated when they are shown
+    void ViewController::event(const EnvirValue& event)
+    {
+        ScopedTiming timing(TimingStats::ViewControllerEvent);
+        TraceRing::record(TraceEventType::QueueReceive, 0);
+
+        latest_value = event;
+        has_value = true;
+        publish_count++;
+        content_pane_stale.fill(true);
+
+        update_content_pane(current_view_id);
+        task_lvgl.request_refresh();
+    }
+
+    // The recorded sample event - the trend chart gets one point per 30 sec record so its
+    // 128 points always span 64 minutes, however often the value is published.  A hidden
+    // chart does not invalidate anything.
+    void ViewController::event(const SampleLog::Record& event)
+    {
+        trend_pane->add_point(event.sample);
+        trend_point_count++;
+
+        if (current_view_id == Trend)
+        {
+            task_lvgl.request_refresh();
+        }
+    }
+
+    // Update a content pane with the latest EnvirValue
+    void ViewController::update_content_pane(ViewID view_id)
+    {
+        if (has_value && content_pane_stale[view_id])
+        {
+            content_pane_stale[view_id] = false;
+
+            if (content_panes[view_id]->update_value(latest_value))
+            {
+                TraceRing::record(TraceEventType::LabelSet, static_cast<uint16_t>(view_id));
+                label_redraw_count++;
+            }
+        }
+    }
 }
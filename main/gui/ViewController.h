@@ -16,16 +16,25 @@
  ***************************************************************************************/
 #pragma once
 
+#include <array>
 #include <memory>                   // for unique_ptr
 #include <unordered_map>
-#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
 #include "gui/DisplayDriver.h"
 #include "gui/MenuPane.h"
 #include "gui/IPane.h"
+#include "gui/IContentPane.h"
+#include "model/EnvirValue.h"
+#include "model/SampleLog.h"
 
 namespace redstone
 {
-    class ViewController
+    class LvglTask;
+    class CPTrend;
+
+    class ViewController : public smooth::core::ipc::IEventListener<EnvirValue>,
+                           public smooth::core::ipc::IEventListener<SampleLog::Record>
     {
         public:
             // Constants & Enums
@@ -34,11 +43,13 @@ namespace redstone
                 Temperature = 0,
                 Humidity,
                 HeatIndex,
-                DewPoint
+                DewPoint,
+                Trend,
+                ViewCount
             };
 
             // Constructor
-            ViewController(smooth::core::Task& task_lvgl);
+            ViewController(LvglTask& task_lvgl);
 
             /// Initialize the view controller
             void init();
@@ -52,17 +63,73 @@ namespace redstone
             /// Show the next view
             void show_next_view();
 
+            /// The published EnvirValue event, the only EnvirValue subscription in the gui
+            void event(const EnvirValue& event) override;
+
+            /// The sample recorded on the fixed 30 sec grid, the next point of the trend chart
+            void event(const SampleLog::Record& event) override;
+
+            /// Get the number of EnvirValue events received
+            uint32_t get_publish_count() const
+            {
+                return publish_count;
+            }
+
+            /// Get the number of content pane value labels redrawn, including lazy redraws on show
+            uint32_t get_label_redraw_count() const
+            {
+                return label_redraw_count;
+            }
+
+            /// Get the number of points added to the trend chart, they are not label redraws
+            uint32_t get_trend_point_count() const
+            {
+                return trend_point_count;
+            }
+
+            /// Check if button edges are waiting to be read by the Lvgl input driver
+            bool has_pending_input() const
+            {
+                return menu_pane.has_buffered_edges();
+            }
+
+            const MenuPane& get_menu_pane() const
+            {
+                return menu_pane;
+            }
+
         private:
-            smooth::core::Task& task_lvgl;
+            /// Update a content pane with the latest EnvirValue if it has not seen it yet
+            /// \param view_id The view of the content pane
+            void update_content_pane(ViewID view_id);
+
+            LvglTask& task_lvgl;
+
+            // Subscriber's queue's
+            using SubQEnvirValue = smooth::core::ipc::SubscribingTaskEventQueue<EnvirValue>;
+            std::shared_ptr<SubQEnvirValue> subr_queue_envir_value;
+            using SubQRecord = smooth::core::ipc::SubscribingTaskEventQueue<SampleLog::Record>;
+            std::shared_ptr<SubQRecord> subr_queue_record;
+
             DisplayDriver display_driver{};
 
-            std::unique_ptr<IPane> content_pane;
+            std::unique_ptr<IContentPane> content_pane;
             std::unique_ptr<IPane> title_pane;
             MenuPane menu_pane{};
 
-            std::unordered_map<ViewID, std::unique_ptr<IPane>> content_panes;
+            std::unordered_map<ViewID, std::unique_ptr<IContentPane>> content_panes;
             std::unordered_map<ViewID, std::unique_ptr<IPane>> title_panes;
+            CPTrend* trend_pane{ nullptr };
             ViewID current_view_id{ Temperature };
             ViewID new_view_id{ Temperature };
+
+            // The latest sample and which content panes have not been updated with it yet
+            EnvirValue latest_value{};
+            bool has_value{ false };
+            std::array<bool, ViewCount> content_pane_stale{};
+
+            uint32_t publish_count{ 0 };
+            uint32_t label_redraw_count{ 0 };
+            uint32_t trend_point_count{ 0 };
     };
 }
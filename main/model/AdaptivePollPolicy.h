@@ -0,0 +1,139 @@
+/****************************************************************************************
+ * AdaptivePollPolicy.h - Chooses the next DHT12 read interval and which readings to publish
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include "model/SampleHistory.h"
+
+namespace redstone
+{
+    // The read interval drops to min_interval as soon as temperature or humidity changes
+    // faster than its rate threshold and doubles on every reading that does not, up to
+    // max_interval.  A reading is only published when it differs from the last published
+    // reading by more than the deadband, so the gui is not redrawn for sensor noise.
+    //
+    // Rates, thresholds and deadbands are in tenths, the resolution of the DHT12.  The rate
+    // is measured on unsmoothed readings, e.g. burst medians, a smoothing filter would
+    // hide most of a ramp from it.
+    class AdaptivePollPolicy
+    {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            struct Config
+            {
+                std::chrono::seconds min_interval{ 10 };
+                std::chrono::seconds max_interval{ 120 };
+                std::chrono::seconds initial_interval{ 30 };
+                int temperature_rate_deci_per_min{ 5 };     // 0.5 degC per minute
+                int humidity_rate_deci_per_min{ 20 };       // 2 %RH per minute
+                int temperature_deadband_deci{ 2 };         // 0.2 degC
+                int humidity_deadband_deci{ 10 };           // 1 %RH
+            };
+
+            explicit AdaptivePollPolicy(const Config& config) :
+                    config(config), interval_s(static_cast<uint32_t>(config.initial_interval.count()))
+            {
+            }
+
+            /// Take a new reading into account and get the time to the next reading
+            /// \param now The time of the reading
+            /// \param sample The reading
+            /// \return Returns the interval to the next reading
+            std::chrono::seconds next_interval(Clock::time_point now, const PackedSample& sample)
+            {
+                if (has_reading)
+                {
+                    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_read_time).count();
+                    elapsed_ms = std::max<decltype(elapsed_ms)>(elapsed_ms, 1);
+
+                    // compare the change against the threshold scaled to the elapsed time
+                    bool fast_temperature = std::abs(sample.temperature_deci_c - last_read.temperature_deci_c) * 60000LL
+                                            > config.temperature_rate_deci_per_min * elapsed_ms;
+                    bool fast_humidity = std::abs(sample.humidity_deci - last_read.humidity_deci) * 60000LL
+                                         > config.humidity_rate_deci_per_min * elapsed_ms;
+
+                    auto interval = fast_temperature || fast_humidity ? config.min_interval
+                                                                      : std::min(get_interval() * 2, config.max_interval);
+                    interval_s.store(static_cast<uint32_t>(interval.count()), std::memory_order_relaxed);
+                }
+
+                last_read = sample;
+                last_read_time = now;
+                has_reading = true;
+                read_count.fetch_add(1, std::memory_order_relaxed);
+
+                return get_interval();
+            }
+
+            /// Check if a reading should be published, a published reading becomes the new reference
+            /// \param sample The reading
+            /// \return Returns true if the reading is outside the deadband of the last published reading
+            bool should_publish(const PackedSample& sample)
+            {
+                bool publish = !has_published
+                               || std::abs(sample.temperature_deci_c - last_published.temperature_deci_c)
+                               > config.temperature_deadband_deci
+                               || std::abs(sample.humidity_deci - last_published.humidity_deci)
+                               > config.humidity_deadband_deci;
+
+                if (publish)
+                {
+                    last_published = sample;
+                    has_published = true;
+                    publish_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    suppressed_count.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                return publish;
+            }
+
+            std::chrono::seconds get_interval() const
+            {
+                return std::chrono::seconds(interval_s.load(std::memory_order_relaxed));
+            }
+
+            uint32_t get_read_count() const
+            {
+                return read_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_publish_count() const
+            {
+                return publish_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_suppressed_count() const
+            {
+                return suppressed_count.load(std::memory_order_relaxed);
+            }
+
+        private:
+            Config config;
+
+            PackedSample last_read{};
+            Clock::time_point last_read_time{};
+            bool has_reading{ false };
+
+            PackedSample last_published{};
+            bool has_published{ false };
+
+            // written by the polling task and read by the 60 s statistics dump
+            std::atomic<uint32_t> interval_s;
+            std::atomic<uint32_t> read_count{ 0 };
+            std::atomic<uint32_t> publish_count{ 0 };
+            std::atomic<uint32_t> suppressed_count{ 0 };
+    };
+}
@@ -0,0 +1,203 @@
+/****************************************************************************************
+ * BusScheduler.h - Reads the sensors registered on one bus in shared bus sessions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "model/ISensor.h"
+#include "model/MultiChannelSample.h"
+
+namespace redstone
+{
+    // Each call to run() is one bus session: every sensor that is due is started, together
+    // with the sensors due within the group window, and every busy sensor does one step.
+    // Pulling sensors that are almost due into the session of a sensor that is due lines
+    // them up so their readings share sessions instead of each sensor using the bus in
+    // sessions of its own.
+    //
+    // A reading is scheduled period after it was due, not after it was started, so neither
+    // multi step readings nor early starts make the period drift.  The time spent in the
+    // sensor steps is measured as bus busy time.
+    //
+    // get_next_run_time() tells the owning task when to run the next session, so the task
+    // sleeps through the waits between the steps and the periods between the readings.
+    template<size_t MaxSensors>
+    class BusScheduler
+    {
+        public:
+            using Clock = ISensor::Clock;
+
+            /// Constructor
+            /// \param group_window Sensors due within this time join the current session
+            explicit BusScheduler(std::chrono::milliseconds group_window) : group_window(group_window)
+            {
+            }
+
+            /// Register a sensor, the sensor id is the order of registration
+            /// \param sensor The sensor, must outlive the scheduler
+            /// \return Returns false if MaxSensors sensors are registered already
+            bool add_sensor(ISensor& sensor)
+            {
+                if (sensor_count == MaxSensors)
+                {
+                    return false;
+                }
+
+                entries[sensor_count++] = Entry{ &sensor, Clock::time_point{}, Clock::time_point{} };
+                return true;
+            }
+
+            /// Run one bus session
+            /// \param now The current time
+            /// \param on_reading Called as on_reading(id, sensor, sample) for each completed reading
+            template<typename OnReading>
+            void run(Clock::time_point now, OnReading&& on_reading)
+            {
+                bool used_bus = false;
+                bool any_due = false;
+
+                for (size_t id = 0; id < sensor_count; id++)
+                {
+                    any_due |= !entries[id].sensor->is_busy() && now >= entries[id].next_due;
+                }
+
+                // sensors almost due start together with a sensor that is due, readings that
+                // start together step together and share their sessions
+                auto start_limit = any_due ? now + group_window : now;
+
+                for (size_t id = 0; id < sensor_count; id++)
+                {
+                    Entry& entry = entries[id];
+
+                    if (!entry.sensor->is_busy() && start_limit >= entry.next_due)
+                    {
+                        entry.sensor->start(now);
+                        entry.due_time = entry.next_due > now ? entry.next_due : now;
+                    }
+
+                    if (entry.sensor->is_busy())
+                    {
+                        sample.reset(static_cast<uint8_t>(id), to_ms(now));
+
+                        auto step_start = Clock::now();
+                        auto status = entry.sensor->poll(now, sample);
+                        busy_this_minute += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - step_start);
+                        used_bus |= status != ISensor::Status::Waiting;
+
+                        if (status == ISensor::Status::Completed)
+                        {
+                            readings.fetch_add(1, std::memory_order_relaxed);
+                            on_reading(id, *entry.sensor, static_cast<const MultiChannelSample&>(sample));
+                        }
+                        else if (status == ISensor::Status::Failed)
+                        {
+                            failures.fetch_add(1, std::memory_order_relaxed);
+                        }
+
+                        // the period is read after on_reading so a reading can change it
+                        if (status == ISensor::Status::Completed || status == ISensor::Status::Failed)
+                        {
+                            auto next_due = entry.due_time + entry.sensor->get_period();
+                            entry.next_due = next_due > now ? next_due : now;
+                        }
+                    }
+                }
+
+                sessions_this_minute += used_bus ? 1 : 0;
+                update_minute(now);
+            }
+
+            /// Get the time the next session has something to do
+            /// \param now The current time
+            /// \return Returns the earliest next step of a busy sensor or due time of an idle sensor,
+            /// not earlier than now, Clock::time_point::max() without sensors
+            Clock::time_point get_next_run_time(Clock::time_point now) const
+            {
+                auto next = Clock::time_point::max();
+
+                for (size_t id = 0; id < sensor_count; id++)
+                {
+                    const Entry& entry = entries[id];
+                    auto time = entry.sensor->is_busy() ? entry.sensor->get_next_step_time(now) : entry.next_due;
+                    next = time < next ? time : next;
+                }
+
+                return next > now ? next : now;
+            }
+
+            size_t get_sensor_count() const
+            {
+                return sensor_count;
+            }
+
+            /// Get the number of sessions that used the bus in the last full minute
+            uint32_t get_sessions_per_minute() const
+            {
+                return sessions_per_minute.load(std::memory_order_relaxed);
+            }
+
+            /// Get the bus busy time of the last full minute
+            uint32_t get_bus_busy_us_per_minute() const
+            {
+                return bus_busy_us_per_minute.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_reading_count() const
+            {
+                return readings.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_failure_count() const
+            {
+                return failures.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct Entry
+            {
+                ISensor* sensor;
+                Clock::time_point next_due;
+                Clock::time_point due_time;
+            };
+
+            static uint32_t to_ms(Clock::time_point time)
+            {
+                return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+            }
+
+            void update_minute(Clock::time_point now)
+            {
+                if (now - minute_start >= std::chrono::minutes(1))
+                {
+                    sessions_per_minute.store(sessions_this_minute, std::memory_order_relaxed);
+                    bus_busy_us_per_minute.store(static_cast<uint32_t>(busy_this_minute.count()), std::memory_order_relaxed);
+                    sessions_this_minute = 0;
+                    busy_this_minute = std::chrono::microseconds{ 0 };
+                    minute_start = now;
+                }
+            }
+
+            std::chrono::milliseconds group_window;
+            std::array<Entry, MaxSensors> entries{};
+            size_t sensor_count{ 0 };
+            MultiChannelSample sample{};
+
+            Clock::time_point minute_start{};
+            uint32_t sessions_this_minute{ 0 };
+            std::chrono::microseconds busy_this_minute{ 0 };
+
+            // written by the polling task and read by the 60 s statistics dump
+            std::atomic<uint32_t> sessions_per_minute{ 0 };
+            std::atomic<uint32_t> bus_busy_us_per_minute{ 0 };
+            std::atomic<uint32_t> readings{ 0 };
+            std::atomic<uint32_t> failures{ 0 };
+    };
+}
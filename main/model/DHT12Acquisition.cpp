@@ -0,0 +1,122 @@
+/****************************************************************************************
+ * DHT12Acquisition.cpp - A DHT12 measurement split into short bounded steps with retries
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include "model/DHT12Acquisition.h"
+#include <algorithm>
+
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Class constants
+    static constexpr uint8_t FirstRegister = 0x00;
+    static constexpr size_t DataLength = 5;
+
+    // Constructor
+    DHT12Acquisition::DHT12Acquisition(II2CBus& bus, const Config& config) : bus(bus), config(config)
+    {
+    }
+
+    // Start a measurement
+    void DHT12Acquisition::start()
+    {
+        if (state == State::Idle)
+        {
+            attempt = 0;
+            state = State::SelectRegister;
+        }
+    }
+
+    // Do the next step of the measurement
+    DHT12Acquisition::Status DHT12Acquisition::poll(Clock::time_point now, float& temperature, float& humidity)
+    {
+        switch (state)
+        {
+            case State::SelectRegister:
+                return select_register(now);
+            case State::ReadData:
+                return read_data(now, temperature, humidity);
+            case State::Backoff:
+                return now >= retry_time ? select_register(now) : Status::Busy;
+            default:
+                return Status::Idle;
+        }
+    }
+
+    // Point the DHT12 at its first register, the data is read on the next poll
+    DHT12Acquisition::Status DHT12Acquisition::select_register(Clock::time_point now)
+    {
+        auto result = bus.write(config.address, &FirstRegister, 1, config.transfer_timeout);
+
+        if (result != II2CBus::Result::Ok)
+        {
+            return transfer_failed(now, result);
+        }
+
+        state = State::ReadData;
+        return Status::Busy;
+    }
+
+    // Read and check the humidity, temperature and checksum bytes
+    DHT12Acquisition::Status DHT12Acquisition::read_data(Clock::time_point now, float& temperature, float& humidity)
+    {
+        uint8_t data[DataLength]{};
+        auto result = bus.read(config.address, data, DataLength, config.transfer_timeout);
+
+        if (result != II2CBus::Result::Ok)
+        {
+            return transfer_failed(now, result);
+        }
+
+        if (!decode(data, temperature, humidity))
+        {
+            checksum_error_count.fetch_add(1, std::memory_order_relaxed);
+            bus.report_data_error();
+            return transfer_failed(now, II2CBus::Result::Error);
+        }
+
+        completed_count.fetch_add(1, std::memory_order_relaxed);
+        state = State::Idle;
+        return Status::Completed;
+    }
+
+    // Schedule a retry with a doubling backoff or give up the measurement
+    DHT12Acquisition::Status DHT12Acquisition::transfer_failed(Clock::time_point now, II2CBus::Result result)
+    {
+        nack_count.fetch_add(result == II2CBus::Result::Nack ? 1 : 0, std::memory_order_relaxed);
+        timeout_count.fetch_add(result == II2CBus::Result::Timeout ? 1 : 0, std::memory_order_relaxed);
+
+        if (++attempt >= config.max_attempts)
+        {
+            failed_count.fetch_add(1, std::memory_order_relaxed);
+            state = State::Idle;
+            return Status::Failed;
+        }
+
+        retry_count.fetch_add(1, std::memory_order_relaxed);
+        auto backoff = std::min(config.first_backoff * (1 << (attempt - 1)), config.max_backoff);
+        retry_time = now + backoff;
+        state = State::Backoff;
+        return Status::Busy;
+    }
+
+    // Decode the DHT12 data bytes: humidity integer and tenths, temperature integer and
+    // tenths with the sign in bit 7, and the low byte of the sum of the four as checksum
+    bool DHT12Acquisition::decode(const uint8_t* data, float& temperature, float& humidity)
+    {
+        if (!is_valid(data, DataLength))
+        {
+            return false;
+        }
+
+        humidity = data[0] + data[1] * 0.1f;
+        temperature = data[2] + (data[3] & 0x7F) * 0.1f;
+        temperature = (data[3] & 0x80) != 0 ? -temperature : temperature;
+
+        return true;
+    }
+}
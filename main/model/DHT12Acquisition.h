@@ -0,0 +1,147 @@
+/****************************************************************************************
+ * DHT12Acquisition.h - A DHT12 measurement split into short bounded steps with retries
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "model/II2CBus.h"
+
+namespace redstone
+{
+    // A measurement is two I2C transfers, selecting the first register and reading the five
+    // data bytes.  Each call to poll() does at most one transfer so the calling task is
+    // blocked for at most one transfer timeout per call and yields between the transfers.
+    // A failed transfer or checksum is retried after a backoff that doubles on every attempt
+    // until the measurement is given up after max_attempts.
+    //
+    // Only the II2CBus interface is used so the class can be driven by a simulated bus.
+    class DHT12Acquisition
+    {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            struct Config
+            {
+                uint8_t address{ 0x5C };
+                std::chrono::milliseconds transfer_timeout{ 20 };
+                int max_attempts{ 4 };
+                std::chrono::milliseconds first_backoff{ 1000 };
+                std::chrono::milliseconds max_backoff{ 8000 };
+            };
+
+            enum class Status
+            {
+                Idle,
+                Busy,
+                Completed,
+                Failed
+            };
+
+            /// Constructor
+            /// \param bus The bus the DHT12 is connected to
+            /// \param config The timeout and retry configuration
+            DHT12Acquisition(II2CBus& bus, const Config& config);
+
+            /// Start a measurement, ignored while a measurement is in progress
+            void start();
+
+            /// Do the next step of the measurement
+            /// \param now The current time
+            /// \param temperature Returns the temperature in degree celsius when Completed
+            /// \param humidity Returns the relative humidity in percent when Completed
+            /// \return Returns Busy while the measurement is in progress, then Completed or Failed once
+            Status poll(Clock::time_point now, float& temperature, float& humidity);
+
+            bool is_busy() const
+            {
+                return state != State::Idle;
+            }
+
+            /// Check the checksum of the DHT12 data bytes
+            /// \param data The data bytes read from the first register
+            /// \param length The number of bytes, must be 5
+            /// \return Returns true if the checksum matches
+            static bool is_valid(const uint8_t* data, size_t length)
+            {
+                return length == 5 && static_cast<uint8_t>(data[0] + data[1] + data[2] + data[3]) == data[4];
+            }
+
+            /// Check if the next poll will wait for a retry instead of using the bus
+            bool is_waiting(Clock::time_point now) const
+            {
+                return state == State::Backoff && now < retry_time;
+            }
+
+            /// Get the time the next poll uses the bus
+            /// \param now The current time
+            /// \return Returns the retry time during a backoff, otherwise now
+            Clock::time_point get_next_step_time(Clock::time_point now) const
+            {
+                return is_waiting(now) ? retry_time : now;
+            }
+
+            uint32_t get_completed_count() const
+            {
+                return completed_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_failed_count() const
+            {
+                return failed_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_retry_count() const
+            {
+                return retry_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_nack_count() const
+            {
+                return nack_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_timeout_count() const
+            {
+                return timeout_count.load(std::memory_order_relaxed);
+            }
+
+            uint32_t get_checksum_error_count() const
+            {
+                return checksum_error_count.load(std::memory_order_relaxed);
+            }
+
+        private:
+            enum class State
+            {
+                Idle,
+                SelectRegister,
+                ReadData,
+                Backoff
+            };
+
+            Status select_register(Clock::time_point now);
+            Status read_data(Clock::time_point now, float& temperature, float& humidity);
+            Status transfer_failed(Clock::time_point now, II2CBus::Result result);
+            static bool decode(const uint8_t* data, float& temperature, float& humidity);
+
+            II2CBus& bus;
+            Config config;
+            State state{ State::Idle };
+            int attempt{ 0 };
+            Clock::time_point retry_time{};
+
+            // written by the polling task and read by the 60 s statistics dump
+            std::atomic<uint32_t> completed_count{ 0 };
+            std::atomic<uint32_t> failed_count{ 0 };
+            std::atomic<uint32_t> retry_count{ 0 };
+            std::atomic<uint32_t> nack_count{ 0 };
+            std::atomic<uint32_t> timeout_count{ 0 };
+            std::atomic<uint32_t> checksum_error_count{ 0 };
+    };
+}
@@ -0,0 +1,100 @@
+/****************************************************************************************
+ * DHT12Sensor.cpp - A DHT12 on the shared I2C bus, read in filtered bursts
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include "model/DHT12Sensor.h"
+
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Class constants
+    static constexpr seconds OversampleSpacing{ 2 };
+
+    // Create the acquisition with the default timeout and retry configuration
+    static DHT12Acquisition::Config acquisition_config(uint8_t address)
+    {
+        DHT12Acquisition::Config config{};
+        config.address = address;
+        return config;
+    }
+
+    // Constructor
+    DHT12Sensor::DHT12Sensor(II2CBus& bus, uint8_t address) : acquisition(bus, acquisition_config(address))
+    {
+    }
+
+    // Start a burst
+    void DHT12Sensor::start(Clock::time_point now)
+    {
+        in_burst = true;
+        next_raw_read = now;
+    }
+
+    // The next raw read of the burst, or the end of the backoff of a retry
+    ISensor::Clock::time_point DHT12Sensor::get_next_step_time(Clock::time_point now) const
+    {
+        if (!acquisition.is_busy())
+        {
+            return next_raw_read > now ? next_raw_read : now;
+        }
+
+        return acquisition.get_next_step_time(now);
+    }
+
+    // Do the next step of the burst
+    ISensor::Status DHT12Sensor::poll(Clock::time_point now, MultiChannelSample& sample)
+    {
+        if (!in_burst)
+        {
+            return Status::Idle;
+        }
+
+        if (!acquisition.is_busy())
+        {
+            if (now < next_raw_read)
+            {
+                return Status::Waiting;
+            }
+
+            acquisition.start();
+        }
+
+        if (acquisition.is_waiting(now))
+        {
+            return Status::Waiting;
+        }
+
+        float temperature, humidity;
+        auto status = acquisition.poll(now, temperature, humidity);
+
+        if (status == DHT12Acquisition::Status::Failed)
+        {
+            sample_filter.reset_burst();
+            in_burst = false;
+            return Status::Failed;
+        }
+
+        if (status == DHT12Acquisition::Status::Completed)
+        {
+            sample_filter.add(PackedSample::pack(temperature, humidity));
+
+            if (!sample_filter.is_complete())
+            {
+                next_raw_read = now + OversampleSpacing;
+                return Status::Busy;
+            }
+
+            auto filtered = sample_filter.decimate();
+            sample.add_channel(MultiChannelSample::Quantity::TemperatureDegreeC, filtered.get_temperature_degree_C());
+            sample.add_channel(MultiChannelSample::Quantity::RelativeHumidity, filtered.get_relative_humidity());
+            in_burst = false;
+            return Status::Completed;
+        }
+
+        return Status::Busy;
+    }
+}
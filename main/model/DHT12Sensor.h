@@ -0,0 +1,78 @@
+/****************************************************************************************
+ * DHT12Sensor.h - A DHT12 on the shared I2C bus, read in filtered bursts
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include "model/DHT12Acquisition.h"
+#include "model/ISensor.h"
+#include "model/SampleFilter.h"
+
+namespace redstone
+{
+    // A reading is a burst of 3 raw reads 2 sec apart (the DHT12 converts at most every
+    // 2 sec), reduced by a median of 3 and an EWMA with alpha 1/4.
+    class DHT12Sensor : public ISensor
+    {
+        public:
+            /// Constructor
+            /// \param bus The bus the DHT12 is connected to
+            /// \param address The 7 bit address of the DHT12
+            DHT12Sensor(II2CBus& bus, uint8_t address);
+
+            const char* get_name() const override
+            {
+                return "DHT12";
+            }
+
+            std::chrono::milliseconds get_period() const override
+            {
+                return period;
+            }
+
+            /// A write of the register address or a 5 byte read, about 0.8 ms at 100 kHz
+            std::chrono::microseconds get_read_cost() const override
+            {
+                return std::chrono::microseconds(800);
+            }
+
+            void start(Clock::time_point now) override;
+
+            Status poll(Clock::time_point now, MultiChannelSample& sample) override;
+
+            bool is_busy() const override
+            {
+                return in_burst;
+            }
+
+            Clock::time_point get_next_step_time(Clock::time_point now) const override;
+
+            /// Set the time between readings
+            void set_period(std::chrono::milliseconds value)
+            {
+                period = value;
+            }
+
+            /// Get the median of the last burst, it follows a change without the lag of the EWMA
+            const PackedSample& get_last_median() const
+            {
+                return sample_filter.get_last_median();
+            }
+
+            /// Get the acquisition and its counters
+            const DHT12Acquisition& get_acquisition() const
+            {
+                return acquisition;
+            }
+
+        private:
+            DHT12Acquisition acquisition;
+            SampleFilter<3, 2> sample_filter{};
+            std::chrono::milliseconds period{ 30000 };
+            bool in_burst{ false };
+            Clock::time_point next_raw_read{};
+    };
+}
@@ -0,0 +1,92 @@
+/****************************************************************************************
+ * EnvirFormulas.h - Single precision heat index and dew point formulas
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <math.h>
+
+namespace redstone
+{
+    // The ESP32 FPU is single precision only, so every literal and function here is float.
+    // A double anywhere in an expression would pull the whole expression into software emulation.
+    // The formulas are constexpr so EnvirLookupTable can evaluate them at compile time.
+    class EnvirFormulas
+    {
+        public:
+            /// Calculate the heat index
+            /// \param temp_deg_f The temperature in degree fahrenheit
+            /// \param humidity The relative humidity in percent
+            /// \return Returns the heat index in fahrenheit
+            static float heat_index_fahrenheit(float temp_deg_f, float humidity)
+            {
+                return heat_index_fahrenheit(temp_deg_f, humidity, [](float x) { return sqrtf(x); });
+            }
+
+            /// Calculate the heat index with a given square root function
+            /// \param temp_deg_f The temperature in degree fahrenheit
+            /// \param humidity The relative humidity in percent
+            /// \param square_root The square root function, sqrtf at run time or a constexpr function at compile time
+            /// \return Returns the heat index in fahrenheit
+            template<typename SquareRoot>
+            static constexpr float heat_index_fahrenheit(float temp_deg_f, float humidity, SquareRoot square_root)
+            {
+                // Using both Rothfusz and Steadman's equations
+                // http://www.wpc.ncep.noaa.gov/html/heatindex_equation.shtml
+
+                float heat_index = 0.5f * (temp_deg_f + 61.0f + ((temp_deg_f - 68.0f) * 1.2f) + (humidity * 0.094f));
+
+                if (heat_index > 79.0f)
+                {
+                    // The Rothfusz regression grouped by powers of humidity, each coefficient
+                    // is a polynomial in temperature evaluated in Horner form
+                    float t = temp_deg_f;
+                    float c0 = -42.379f + t * (2.04901523f + t * -0.00683783f);
+                    float c1 = 10.14333127f + t * (-0.22475541f + t * 0.00122874f);
+                    float c2 = -0.05481717f + t * (0.00085282f + t * -0.00000199f);
+
+                    heat_index = c0 + humidity * (c1 + humidity * c2);
+
+                    if (humidity < 13.0f && temp_deg_f >= 80.0f && temp_deg_f <= 112.0f)
+                    {
+                        float distance_from_95 = temp_deg_f > 95.0f ? temp_deg_f - 95.0f : 95.0f - temp_deg_f;
+                        heat_index -= ((13.0f - humidity) * 0.25f) * square_root((17.0f - distance_from_95) * 0.05882f);
+                    }
+
+                    if (humidity > 85.0f && temp_deg_f >= 80.0f && temp_deg_f <= 87.0f)
+                    {
+                        heat_index += ((humidity - 85.0f) * 0.1f) * ((87.0f - temp_deg_f) * 0.2f);
+                    }
+                }
+
+                return heat_index;
+            }
+
+            /// Calculate the dew point
+            /// \param temp_deg_c The temperature in degree celsius
+            /// \param humidity The relative humidity in percent
+            /// \return Returns the dew point in celsius
+            static constexpr float dew_point_celsius(float temp_deg_c, float humidity)
+            {
+                // dewPoint function NOAA
+                // reference (1) : http://wahiduddin.net/calc/density_algorithms.htm
+                // reference (2) : http://www.colorado.edu/geography/weather_station/Geog_site/about.htm
+                // Good approximation for 0 ... +70 °C with max. deviation less than 0.25 °C
+
+                float t = temp_deg_c;
+                float x = 1.0f - (0.01f * humidity);
+                float b = (2.5f + 0.007f * t) * x;
+
+                // x^14 by repeated squaring, x^14 = x^8 * x^4 * x^2
+                float x2 = x * x;
+                float x4 = x2 * x2;
+                float x8 = x4 * x4;
+                float x14 = x8 * x4 * x2;
+
+                return t - (14.55f + 0.114f * t) * x - (b * b * b) - (15.9f + 0.117f * t) * x14;
+            }
+    };
+}
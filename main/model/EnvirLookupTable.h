@@ -0,0 +1,140 @@
+/****************************************************************************************
+ * EnvirLookupTable.h - Compile time generated heat index and dew point tables with
+ *                      bilinear interpolation
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "model/EnvirFormulas.h"
+
+namespace redstone
+{
+    // The tables cover TempMinC to TempMaxC in steps of TempStepDeciC tenths of a degree and
+    // 0 to 100 %RH in steps of HumidityStepDeci tenths of a percent.  Smaller steps cost more
+    // flash (FlashBytes) and give smaller interpolation errors.  Inputs outside the range
+    // are clamped to the edge of the table.
+    //
+    // The heat index has a step where the Rothfusz regression takes over from the simple
+    // formula, interpolating across that step is where most of the error comes from.
+    template<int TempMinC, int TempMaxC, int TempStepDeciC, int HumidityStepDeci>
+    class EnvirLookupTable
+    {
+        public:
+            static constexpr int TempPoints = ((TempMaxC - TempMinC) * 10) / TempStepDeciC + 1;
+            static constexpr int HumidityPoints = 1000 / HumidityStepDeci + 1;
+            static constexpr size_t FlashBytes = 2 * TempPoints * HumidityPoints * sizeof(float);
+
+            static_assert(((TempMaxC - TempMinC) * 10) % TempStepDeciC == 0, "Temperature range must be a multiple of the step");
+            static_assert(1000 % HumidityStepDeci == 0, "Humidity range must be a multiple of the step");
+
+            /// Look up the heat index
+            /// \param temp_deg_c The temperature in degree celsius
+            /// \param humidity The relative humidity in percent
+            /// \return Returns the heat index in fahrenheit
+            static float heat_index_fahrenheit(float temp_deg_c, float humidity)
+            {
+                return interpolate(heat_index_f_table, temp_deg_c, humidity);
+            }
+
+            /// Look up the dew point
+            /// \param temp_deg_c The temperature in degree celsius
+            /// \param humidity The relative humidity in percent
+            /// \return Returns the dew point in celsius
+            static float dew_point_celsius(float temp_deg_c, float humidity)
+            {
+                return interpolate(dew_point_c_table, temp_deg_c, humidity);
+            }
+
+        private:
+            using Table = std::array<float, TempPoints * HumidityPoints>;
+
+            static constexpr float temp_step = TempStepDeciC / 10.0f;
+            static constexpr float humidity_step = HumidityStepDeci / 10.0f;
+
+            // Newton-Raphson square root, only used while generating the tables
+            static constexpr float constexpr_sqrt(float x)
+            {
+                float root = x > 1.0f ? x : 1.0f;
+
+                for (int i = 0; i < 20; i++)
+                {
+                    root = 0.5f * (root + x / root);
+                }
+
+                return x > 0.0f ? root : 0.0f;
+            }
+
+            static constexpr Table generate_heat_index()
+            {
+                Table table{};
+
+                for (int t = 0; t < TempPoints; t++)
+                {
+                    float temp_deg_f = ((TempMinC + t * temp_step) * 9.0f) / 5.0f + 32.0f;
+
+                    for (int h = 0; h < HumidityPoints; h++)
+                    {
+                        table[t * HumidityPoints + h] =
+                            EnvirFormulas::heat_index_fahrenheit(temp_deg_f, h * humidity_step, constexpr_sqrt);
+                    }
+                }
+
+                return table;
+            }
+
+            static constexpr Table generate_dew_point()
+            {
+                Table table{};
+
+                for (int t = 0; t < TempPoints; t++)
+                {
+                    for (int h = 0; h < HumidityPoints; h++)
+                    {
+                        table[t * HumidityPoints + h] =
+                            EnvirFormulas::dew_point_celsius(TempMinC + t * temp_step, h * humidity_step);
+                    }
+                }
+
+                return table;
+            }
+
+            // Find the cell the value is in and how far into the cell it is
+            static void locate(float value, float min, float step, int points, int& index, float& fraction)
+            {
+                float position = (value - min) / step;
+                position = position < 0.0f ? 0.0f : position;
+                position = position > points - 1 ? points - 1 : position;
+
+                index = static_cast<int>(position);
+                index = index > points - 2 ? points - 2 : index;
+                fraction = position - index;
+            }
+
+            static float interpolate(const Table& table, float temp_deg_c, float humidity)
+            {
+                int t;
+                int h;
+                float ft;
+                float fh;
+
+                locate(temp_deg_c, TempMinC, temp_step, TempPoints, t, ft);
+                locate(humidity, 0.0f, humidity_step, HumidityPoints, h, fh);
+
+                const float* row0 = &table[t * HumidityPoints + h];
+                const float* row1 = row0 + HumidityPoints;
+
+                float v0 = row0[0] + (row0[1] - row0[0]) * fh;
+                float v1 = row1[0] + (row1[1] - row1[0]) * fh;
+
+                return v0 + (v1 - v0) * ft;
+            }
+
+            static constexpr Table heat_index_f_table = generate_heat_index();
+            static constexpr Table dew_point_c_table = generate_dew_point();
+    };
+}
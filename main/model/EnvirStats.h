@@ -0,0 +1,70 @@
+/****************************************************************************************
+ * EnvirStats.h - The rolling statistics published alongside each EnvirValue
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "model/RollingStats.h"
+
+namespace redstone
+{
+    class EnvirStats
+    {
+        public:
+            enum Window : int
+            {
+                OneHour = 0,
+                OneDay,
+                WindowCount
+            };
+
+            struct Summary
+            {
+                float min;
+                float max;
+                float mean;
+                uint32_t count;
+            };
+
+            EnvirStats() {}
+
+            /// Get the temperature statistics in degree celsius
+            /// \param window The window of the statistics
+            const Summary& get_temperature_degree_C(Window window) const
+            {
+                return temperature[window];
+            }
+
+            /// Get the relative humidity statistics in percent
+            /// \param window The window of the statistics
+            const Summary& get_relative_humidity(Window window) const
+            {
+                return humidity[window];
+            }
+
+            /// Set the statistics of a window from rolling results in tenths
+            /// \param window The window of the statistics
+            /// \param temperature_deci_c The temperature result in tenths of a degree celsius
+            /// \param humidity_deci The humidity result in tenths of a percent
+            void set(Window window, const RollingResult& temperature_deci_c, const RollingResult& humidity_deci)
+            {
+                temperature[window] = to_summary(temperature_deci_c);
+                humidity[window] = to_summary(humidity_deci);
+            }
+
+        private:
+            static Summary to_summary(const RollingResult& result)
+            {
+                float mean = result.count > 0 ? static_cast<float>(result.sum) / result.count : 0.0f;
+                return Summary{ result.min * 0.1f, result.max * 0.1f, mean * 0.1f, result.count };
+            }
+
+            std::array<Summary, WindowCount> temperature{};
+            std::array<Summary, WindowCount> humidity{};
+    };
+}
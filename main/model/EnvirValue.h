@@ -16,8 +16,19 @@
  ***************************************************************************************/
 #pragma once
 
-#include <string>
-#include <math.h>
+#include "model/EnvirFormulas.h"
+
+// Set to 1 to look up the heat index and dew point in compile time generated tables instead
+// of calculating them.  The default table (0 to 60 degC by 1 degC, 0 to 100 %RH by 2 %RH)
+// takes 24888 bytes of flash, is within 0.2 degC of the dew point formula and within 1.4 degF
+// of the heat index formula, the larger error is next to the step at 79 degF heat index.
+#ifndef ENVIR_VALUE_USE_LOOKUP_TABLE
+#define ENVIR_VALUE_USE_LOOKUP_TABLE 0
+#endif
+
+#if ENVIR_VALUE_USE_LOOKUP_TABLE
+#include "model/EnvirLookupTable.h"
+#endif
 
 namespace redstone
 {
@@ -30,7 +41,7 @@ namespace redstone
             /// \param return Return the temperature in degree farenheit
             float get_temperture_degree_F() const
             {
-                return ((temperature * 9) / 5) + 32;
+                return get_derived().temperature_f;
             }
 
             /// Get the temperature in degree celsius
@@ -45,6 +56,7 @@ namespace redstone
             void set_temperture_degree_C(float value)
             {
                 temperature = value;
+                derived_valid = false;
             }
 
             /// Get the relative humidity
@@ -59,77 +71,77 @@ namespace redstone
             void set_relative_humidity(float value)
             {
                 humidity = value;
+                derived_valid = false;
             }
 
             /// Get the heat index fahrenheit
             /// \param return Return the heat index in fahrenheit
             float get_heat_index_fahrenheit() const
             {
-                // Using both Rothfusz and Steadman's equations
-	            // http://www.wpc.ncep.noaa.gov/html/heatindex_equation.shtml
-
-                float heat_index;
-                float temp_deg_f = get_temperture_degree_F();
-
-                heat_index = 0.5 * (temp_deg_f + 61.0 +((temp_deg_f -68) * 1.2) + (humidity * 0.094));
-
-                if (heat_index > 79)
-                {
-                    heat_index = -42.379 + 2.04901523 * temp_deg_f + 10.14333127 * humidity
-				                 + -0.22475541 * temp_deg_f * humidity
-				                 + -0.00683783 * pow(temp_deg_f, 2)
-				                 + -0.05481717 * pow(humidity, 2)
-				                 + 0.00122874 * pow(temp_deg_f, 2) * humidity
-				                 + 0.00085282 * temp_deg_f * pow(humidity, 2)
-				                 + -0.00000199 * pow(temp_deg_f, 2) * pow(humidity, 2);
-
-                    if (humidity<13 && temp_deg_f>=80.0 && temp_deg_f<=112.0)
-                    {
-                        heat_index -= ((13.0 - humidity) * 0.25) * sqrt((17.0 - abs(temp_deg_f - 95.0)) * 0.05882);
-                    }
-
-                    if (humidity>85.0 && temp_deg_f>=80.0 && temp_deg_f<=87.0)
-                    {
-                        heat_index += ((humidity - 85.0) * 0.1) * ((87.0 - temp_deg_f) * 0.2);
-                    }
-                }
-
-                return heat_index;
+                return get_derived().heat_index_f;
             }
 
             /// Get the heat index celsius
             /// \param return Return the heat index in celsius
             float get_heat_index_celsius() const
             {
-                return (get_heat_index_fahrenheit() -32) * 0.55555;
+                return get_derived().heat_index_c;
             }
 
             /// Get the dew point value in celsius
             /// \return Retuen the dew point value in celsius
             float get_dew_point_celsius() const
             {
-                // dewPoint function NOAA
-                // reference (1) : http://wahiduddin.net/calc/density_algorithms.htm
-                // reference (2) : http://www.colorado.edu/geography/weather_station/Geog_site/about.htm
-                // Good approximation for 0 ... +70 °C with max. deviation less than 0.25 °C
-
-                float dew_point = temperature - (14.55 + 0.114 * temperature) * (1 - (0.01 * humidity)) 
-                                  - pow(((2.5 + 0.007 * temperature) * (1 - (0.01 * humidity))),3) 
-                                  - (15.9 + 0.117 * temperature) * pow((1 - (0.01 * humidity)), 14);
-
-                return dew_point;
+                return get_derived().dew_point_c;
             }
 
-            
             /// Get the dew point value in fahrenheit
             /// \return Retuen the dew point value in fahrenheit
             float get_dew_point_fahrenheit() const
             {
-                return get_dew_point_celsius() * 1.8 + 32;
+                return get_derived().dew_point_f;
             }
 
         private:
-            float temperature;
-            float humidity;
+#if ENVIR_VALUE_USE_LOOKUP_TABLE
+            using LookupTable = EnvirLookupTable<0, 60, 10, 20>;
+#endif
+
+            // The values calculated from temperature and humidity
+            struct Derived
+            {
+                float temperature_f;
+                float heat_index_f;
+                float heat_index_c;
+                float dew_point_c;
+                float dew_point_f;
+            };
+
+            /// Get the derived values, they are calculated once per set of temperature and humidity
+            const Derived& get_derived() const
+            {
+                if (!derived_valid)
+                {
+                    derived.temperature_f = ((temperature * 9.0f) / 5.0f) + 32.0f;
+#if ENVIR_VALUE_USE_LOOKUP_TABLE
+                    derived.heat_index_f = LookupTable::heat_index_fahrenheit(temperature, humidity);
+                    derived.dew_point_c = LookupTable::dew_point_celsius(temperature, humidity);
+#else
+                    derived.heat_index_f = EnvirFormulas::heat_index_fahrenheit(derived.temperature_f, humidity);
+                    derived.dew_point_c = EnvirFormulas::dew_point_celsius(temperature, humidity);
+#endif
+                    derived.heat_index_c = (derived.heat_index_f - 32.0f) * 0.55555f;
+                    derived.dew_point_f = derived.dew_point_c * 1.8f + 32.0f;
+                    derived_valid = true;
+                }
+
+                return derived;
+            }
+
+            float temperature{ 0 };
+            float humidity{ 0 };
+
+            mutable Derived derived{};
+            mutable bool derived_valid{ false };
     };
 }
@@ -0,0 +1,171 @@
+/****************************************************************************************
+ * I2CBus.cpp - An ESP-IDF I2C master port with a bounded time per transfer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#include "model/I2CBus.h"
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "I2CBus";
+    static constexpr uint32_t ApbClockHz = 80 * 1000 * 1000;
+    static constexpr std::chrono::milliseconds ProbeTimeout{ 20 };
+
+    // Constructor
+    I2CBus::I2CBus(i2c_port_t port) : port(port)
+    {
+    }
+
+    // Try the speeds from the fastest down, the slowest speed is kept if nothing else works
+    uint32_t I2CBus::probe_clock(uint8_t address, uint8_t reg, size_t read_length, int attempts, Validator validate)
+    {
+        uint8_t data[8]{};
+        read_length = read_length < sizeof(data) ? read_length : sizeof(data);
+
+        for (size_t index = 0; index < ClockSpeeds.size(); index++)
+        {
+            set_speed(index);
+            bool reliable = true;
+
+            for (int i = 0; i < attempts && reliable; i++)
+            {
+                reliable = write(address, &reg, 1, ProbeTimeout) == Result::Ok
+                           && read(address, data, read_length, ProbeTimeout) == Result::Ok
+                           && (validate == nullptr || validate(data, read_length));
+            }
+
+            Log::info(TAG, "Probe at {} kHz --- {}", ClockSpeeds[index] / 1000, reliable ? "Succeeded" : "Failed");
+
+            if (reliable)
+            {
+                break;
+            }
+        }
+
+        recent_failures = 0;
+        return get_clock_hz();
+    }
+
+    // Set the clock speed, all times are counted in APB clock cycles.  The data and the start
+    // and stop conditions are timed the way i2c_param_config() times them, otherwise they keep
+    // the timing of the speed the port was configured at and a slower clock still violates it.
+    void I2CBus::set_speed(size_t index)
+    {
+        int half_period = static_cast<int>(ApbClockHz / ClockSpeeds[index]) / 2;
+        i2c_set_period(port, half_period, half_period);
+        i2c_set_data_timing(port, half_period / 2, half_period / 2);
+        i2c_set_start_timing(port, half_period, half_period);
+        i2c_set_stop_timing(port, half_period, half_period);
+        speed_index = index;
+        clock_hz.store(ClockSpeeds[index], std::memory_order_relaxed);
+    }
+
+    // The last read was counted as a successful transfer, count it as a failed one instead
+    void I2CBus::report_data_error()
+    {
+        speed_counters[speed_index].errors.fetch_add(1, std::memory_order_relaxed);
+        recent_failures |= 1;
+        step_down_on_errors();
+    }
+
+    // Keep the result of the last transfer
+    void I2CBus::track_errors(bool failed)
+    {
+        recent_failures = (recent_failures << 1) | (failed ? 1 : 0);
+        step_down_on_errors();
+    }
+
+    // Step down one speed when too many of the last 32 transfers failed
+    void I2CBus::step_down_on_errors()
+    {
+        if (__builtin_popcount(recent_failures) >= StepDownErrors && speed_index + 1 < ClockSpeeds.size())
+        {
+            set_speed(speed_index + 1);
+            recent_failures = 0;
+            Log::warning(TAG, "Too many transfer errors, clock stepped down to {} kHz", get_clock_hz() / 1000);
+        }
+    }
+
+    // Write bytes to a device
+    II2CBus::Result I2CBus::write(uint8_t address, const uint8_t* data, size_t length,
+                                  std::chrono::milliseconds timeout)
+    {
+        i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+        i2c_master_start(cmd);
+        i2c_master_write_byte(cmd, static_cast<uint8_t>((address << 1) | I2C_MASTER_WRITE), true);
+        i2c_master_write(cmd, const_cast<uint8_t*>(data), length, true);
+        i2c_master_stop(cmd);
+
+        return execute(cmd, timeout);
+    }
+
+    // Read bytes from a device
+    II2CBus::Result I2CBus::read(uint8_t address, uint8_t* data, size_t length,
+                                 std::chrono::milliseconds timeout)
+    {
+        i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+        i2c_master_start(cmd);
+        i2c_master_write_byte(cmd, static_cast<uint8_t>((address << 1) | I2C_MASTER_READ), true);
+        i2c_master_read(cmd, data, length, I2C_MASTER_LAST_NACK);
+        i2c_master_stop(cmd);
+
+        return execute(cmd, timeout);
+    }
+
+    // Run the command link, the driver gives up and resets the bus after the timeout
+    II2CBus::Result I2CBus::execute(i2c_cmd_handle_t cmd, std::chrono::milliseconds timeout)
+    {
+        // round up so a timeout shorter than one FreeRTOS tick does not become zero
+        TickType_t ticks = (static_cast<TickType_t>(timeout.count()) + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+
+        int64_t start = esp_timer_get_time();
+        esp_err_t err = i2c_master_cmd_begin(port, cmd, ticks);
+        auto duration = static_cast<uint32_t>(esp_timer_get_time() - start);
+        i2c_cmd_link_delete(cmd);
+
+        // the durations are of successful transfers only, a timeout would skew the average
+        auto& counters = speed_counters[speed_index];
+        counters.transfers.fetch_add(1, std::memory_order_relaxed);
+
+        if (err == ESP_OK)
+        {
+            counters.total_us.fetch_add(duration, std::memory_order_relaxed);
+
+            // this task is the only writer so the maximum needs no compare and exchange
+            if (duration > counters.max_us.load(std::memory_order_relaxed))
+            {
+                counters.max_us.store(duration, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            counters.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        track_errors(err != ESP_OK);
+
+        switch (err)
+        {
+            case ESP_OK:
+                return Result::Ok;
+            case ESP_FAIL:
+                return Result::Nack;
+            case ESP_ERR_TIMEOUT:
+                return Result::Timeout;
+            default:
+                return Result::Error;
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/****************************************************************************************
+ * I2CBus.h - An ESP-IDF I2C master port with a bounded time per transfer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <driver/i2c.h>
+#include "model/II2CBus.h"
+
+namespace redstone
+{
+    // The port must already be configured and the driver installed, e.g. by the
+    // smooth::core::io::i2c::Master that created the devices on the bus.
+    //
+    // The clock starts at the slowest speed.  probe_clock() selects the fastest speed at
+    // which a device answers reliably and the bus steps down one speed by itself when
+    // StepDownErrors of the last 32 transfers failed, e.g. when the pull-ups cannot keep up
+    // as the board warms up.  A read whose data fails its check counts as a failed transfer.
+    // It never steps up again by itself.
+    class I2CBus : public II2CBus
+    {
+        public:
+            static constexpr std::array<uint32_t, 3> ClockSpeeds{ 400 * 1000, 200 * 1000, 100 * 1000 };
+            static constexpr int StepDownErrors = 4;
+
+            // The transfers at one clock speed, a copy of the counters another task can take
+            struct SpeedStats
+            {
+                uint32_t transfers;
+                uint32_t errors;
+                uint32_t total_us;
+                uint32_t max_us;
+            };
+
+            // Checks the data read while probing, e.g. a checksum
+            using Validator = bool (*)(const uint8_t* data, size_t length);
+
+            /// Constructor
+            /// \param port The I2C port
+            explicit I2CBus(i2c_port_t port);
+
+            /// Find the fastest clock speed at which every probe transfer succeeds
+            /// \param address The 7 bit address of the device to probe
+            /// \param reg The register to select before reading
+            /// \param read_length The number of bytes to read
+            /// \param attempts The number of probe reads at each speed
+            /// \param validate Checks the data read, nullptr to only check the transfers
+            /// \return Returns the selected clock speed in Hz
+            uint32_t probe_clock(uint8_t address, uint8_t reg, size_t read_length, int attempts, Validator validate);
+
+            /// Get the current clock speed in Hz
+            uint32_t get_clock_hz() const
+            {
+                return clock_hz.load(std::memory_order_relaxed);
+            }
+
+            /// Get the transfer statistics of a clock speed
+            /// \param index The index of the speed in ClockSpeeds
+            SpeedStats get_speed_stats(size_t index) const
+            {
+                const SpeedCounters& counters = speed_counters[index];
+                return SpeedStats{ counters.transfers.load(std::memory_order_relaxed),
+                                   counters.errors.load(std::memory_order_relaxed),
+                                   counters.total_us.load(std::memory_order_relaxed),
+                                   counters.max_us.load(std::memory_order_relaxed) };
+            }
+
+            Result write(uint8_t address, const uint8_t* data, size_t length,
+                         std::chrono::milliseconds timeout) override;
+
+            Result read(uint8_t address, uint8_t* data, size_t length,
+                        std::chrono::milliseconds timeout) override;
+
+            void report_data_error() override;
+
+        private:
+            // Written by the task using the bus and read by the 60 s statistics dump
+            struct SpeedCounters
+            {
+                std::atomic<uint32_t> transfers{ 0 };
+                std::atomic<uint32_t> errors{ 0 };
+                std::atomic<uint32_t> total_us{ 0 };
+                std::atomic<uint32_t> max_us{ 0 };
+            };
+
+            Result execute(i2c_cmd_handle_t cmd, std::chrono::milliseconds timeout);
+            void set_speed(size_t index);
+            void track_errors(bool failed);
+            void step_down_on_errors();
+
+            i2c_port_t port;
+            size_t speed_index{ ClockSpeeds.size() - 1 };
+            std::atomic<uint32_t> clock_hz{ ClockSpeeds.back() };
+            uint32_t recent_failures{ 0 };
+            std::array<SpeedCounters, ClockSpeeds.size()> speed_counters{};
+    };
+}
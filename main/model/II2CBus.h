@@ -0,0 +1,51 @@
+/****************************************************************************************
+ * II2CBus.h - An I2C bus with a bounded time per transfer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace redstone
+{
+    class II2CBus
+    {
+        public:
+            enum class Result
+            {
+                Ok,
+                Nack,
+                Timeout,
+                Error
+            };
+
+            virtual ~II2CBus() {};
+
+            /// Write bytes to a device
+            /// \param address The 7 bit device address
+            /// \param data The bytes to write
+            /// \param length The number of bytes to write
+            /// \param timeout The longest time the transfer may block the calling task
+            /// \return Returns the result of the transfer
+            virtual Result write(uint8_t address, const uint8_t* data, size_t length,
+                                 std::chrono::milliseconds timeout) = 0;
+
+            /// Read bytes from a device
+            /// \param address The 7 bit device address
+            /// \param data The buffer for the bytes read
+            /// \param length The number of bytes to read
+            /// \param timeout The longest time the transfer may block the calling task
+            /// \return Returns the result of the transfer
+            virtual Result read(uint8_t address, uint8_t* data, size_t length,
+                                std::chrono::milliseconds timeout) = 0;
+
+            /// Report that the data of the last successful read failed its check, e.g. a
+            /// checksum, a corrupted read counts as a failed transfer
+            virtual void report_data_error() = 0;
+    };
+}
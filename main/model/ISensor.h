@@ -0,0 +1,59 @@
+/****************************************************************************************
+ * ISensor.h - A sensor on a shared bus that is read in short bounded steps
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <chrono>
+#include "model/MultiChannelSample.h"
+
+namespace redstone
+{
+    class ISensor
+    {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            enum class Status
+            {
+                Idle,
+                Busy,
+                Waiting,
+                Completed,
+                Failed
+            };
+
+            virtual ~ISensor() {};
+
+            /// Get the name of the sensor
+            virtual const char* get_name() const = 0;
+
+            /// Get the time between readings, may change after each reading
+            virtual std::chrono::milliseconds get_period() const = 0;
+
+            /// Get the expected bus time of one step
+            virtual std::chrono::microseconds get_read_cost() const = 0;
+
+            /// Start a reading
+            /// \param now The current time
+            virtual void start(Clock::time_point now) = 0;
+
+            /// Do the next step of the reading, at most one bus transfer
+            /// \param now The current time
+            /// \param sample Receives the channels when Completed
+            /// \return Returns Busy after a bus transfer, Waiting when the reading is in progress but
+            /// did not use the bus, then Completed or Failed once
+            virtual Status poll(Clock::time_point now, MultiChannelSample& sample) = 0;
+
+            /// Check if a reading is in progress
+            virtual bool is_busy() const = 0;
+
+            /// Get the time the next poll of a reading in progress has something to do
+            /// \param now The current time
+            /// \return Returns now if the next poll uses the bus right away, or the end of a wait
+            virtual Clock::time_point get_next_step_time(Clock::time_point now) const = 0;
+    };
+}
@@ -0,0 +1,101 @@
+/****************************************************************************************
+ * MultiChannelSample.h - A reading of one sensor with up to four channels, published by PollSensorTask
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace redstone
+{
+    class MultiChannelSample
+    {
+        public:
+            static constexpr int MaxChannels = 4;
+
+            enum class Quantity : uint8_t
+            {
+                None = 0,
+                TemperatureDegreeC,
+                RelativeHumidity,
+                PressureHectopascal
+            };
+
+            struct Channel
+            {
+                Quantity quantity;
+                float value;
+            };
+
+            MultiChannelSample() {}
+
+            /// Start a new sample of a sensor, removes all channels
+            /// \param id The id of the sensor in the bus scheduler
+            /// \param time_ms The time of the sample in milliseconds since boot
+            void reset(uint8_t id, uint32_t time_ms)
+            {
+                sensor_id = id;
+                time = time_ms;
+                count = 0;
+            }
+
+            /// Add a channel, ignored when all channels are used
+            /// \param quantity What the channel measures
+            /// \param value The value of the channel
+            void add_channel(Quantity quantity, float value)
+            {
+                if (count < MaxChannels)
+                {
+                    channels[count++] = Channel{ quantity, value };
+                }
+            }
+
+            /// Find the value of a channel
+            /// \param quantity What the channel measures
+            /// \param value Returns the value when found
+            /// \return Returns true if the sample has the channel
+            bool find(Quantity quantity, float& value) const
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    if (channels[i].quantity == quantity)
+                    {
+                        value = channels[i].value;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            uint8_t get_sensor_id() const
+            {
+                return sensor_id;
+            }
+
+            uint32_t get_time_ms() const
+            {
+                return time;
+            }
+
+            int get_channel_count() const
+            {
+                return count;
+            }
+
+            const Channel& get_channel(int index) const
+            {
+                return channels[index];
+            }
+
+        private:
+            std::array<Channel, MaxChannels> channels{};
+            uint8_t sensor_id{ 0 };
+            uint8_t count{ 0 };
+            uint32_t time{ 0 };
+    };
+}
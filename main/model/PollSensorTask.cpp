@@ -16,40 +16,65 @@
  ***************************************************************************************/
 #include "model/PollSensorTask.h"
 #include <smooth/core/ipc/Publisher.h>
+#include "stats/TimingStats.h"
+#include "stats/TraceRing.h"
 
 using namespace std::chrono;
 using namespace smooth::core;
 using namespace smooth::core::ipc;
+using namespace smooth::core::timer;
 using namespace smooth::application::sensor;
 
 namespace redstone
 {
     // Class constants
     static const char* TAG = "PollSensorTask";
+    static constexpr seconds RecordInterval{ 30 };
+    static constexpr int SessionTimerId = 2;
 
     // Constructor
     PollSensorTask::PollSensorTask() :
-            smooth::core::Task("PollSensorTask", 3300, 10, seconds(30)),
+            smooth::core::Task("PollSensorTask", 3300, 10, seconds(60)),
 
             // The Task Name = "PollSensorTask"
             // The stack size is 3300 bytes
             // The priority is set to 10
-            // The tick interval is 30 sec
+            // The tick interval is 60 sec, the sessions run from the session timer which is
+            // armed for the next sensor step or recorded sample, the tick is only a safety net
+
+            session_timer_queue(ExpiredQueue::create(2, *this, *this)),
+            session_timer(Timer::create(SessionTimerId, session_timer_queue, false, seconds(1))),
 
             i2c_master(I2C_NUM_0,                       // I2C Port 0
                        GPIO_NUM_13,                     // SCL pin
                        false,                           // SCL internal pullup NOT enabled
                        GPIO_NUM_25,                     // SDA pin
                        false,                           // SDA internal pullup NOT enabled
-                       100 * 1000)                      // clock frequency - 100kHz
+                       100 * 1000)                      // clock frequency - 100kHz until i2c_bus probes it
     {
     }
 
     // Initialize the Task
     void PollSensorTask::init()
     {
+        history = std::make_unique<History>();
+        rolling_stats = std::make_unique<RollingStatsWindows>();
+        Log::info(TAG, "Sample history: {} samples, {} bytes", History::capacity(), sizeof(History));
+
         dht12_initialized = init_i2c_dht12();
         Log::info(TAG, "DHT12 intialization --- {}", dht12_initialized ? "Succeeded" : "Failed");
+
+        if (dht12_initialized)
+        {
+            // the DHT12 answers with a checksum so a corrupted read at a too fast clock is caught
+            uint32_t clock_hz = i2c_bus.probe_clock(0x5C, 0x00, 5, 5, DHT12Acquisition::is_valid);
+            Log::info(TAG, "I2C clock --- {} kHz", clock_hz / 1000);
+
+            dht12.set_period(poll_policy.get_interval());
+            bus_scheduler.add_sensor(dht12);
+        }
+
+        session_timer->start(milliseconds(1));
     }
 
     // Initialize the I2C DHT12 device
@@ -74,18 +99,119 @@ namespace redstone
         return res;
     }
 
-    // The task tick event happens every 30 seconds
+    // Add a sample to the rolling statistics, the cost per sample does not depend on the window length
+    void PollSensorTask::update_rolling_stats(const PackedSample& sample)
+    {
+        auto& windows = *rolling_stats;
+        windows.temperature_hour.add(sample.temperature_deci_c);
+        windows.humidity_hour.add(static_cast<int16_t>(sample.humidity_deci));
+        windows.temperature_day.add(sample.temperature_deci_c);
+        windows.humidity_day.add(static_cast<int16_t>(sample.humidity_deci));
+
+        envir_stats.set(EnvirStats::OneHour, windows.temperature_hour.get(), windows.humidity_hour.get());
+        envir_stats.set(EnvirStats::OneDay, windows.temperature_day.get(), windows.humidity_day.get());
+    }
+
+    // The task tick event happens every 60 seconds
     void PollSensorTask::tick()
     {
-        if (dht12_initialized)
+        run_session();
+    }
+
+    // The session timer expired
+    void PollSensorTask::event(const TimerExpiredEvent& event)
+    {
+        run_session();
+    }
+
+    // One bus session in which every due sensor does at most one I2C transfer, so the task is
+    // blocked for at most one transfer timeout per sensor, then sleep until the next step
+    void PollSensorTask::run_session()
+    {
+        ScopedTiming timing(TimingStats::PollSensorTick);
+
+        auto now = steady_clock::now();
+
+        bus_scheduler.run(now, [this, now](size_t id, ISensor& sensor, const MultiChannelSample& sample)
+        {
+            TraceRing::record(TraceEventType::SampleRead, static_cast<uint16_t>(id));
+            Publisher<MultiChannelSample>::publish(sample);
+
+            if (&sensor == &dht12)
+            {
+                handle_dht12_reading(now, sample);
+            }
+        });
+
+        if (has_reading && now >= next_record_time)
         {
-            float temperature, humidity;
-            sensor->read_measurements(humidity, temperature);
+            record_sample(latest_sample);
+
+            // keep the 30 sec cadence unless the task fell behind by more than one interval
+            next_record_time = now - next_record_time > RecordInterval ? now + RecordInterval
+                                                                       : next_record_time + RecordInterval;
+        }
+
+        arm_session_timer();
+    }
+
+    // Arm the session timer for the next sensor step or recorded sample, a sensor in a backoff
+    // or between the reads of a burst does not wake the task up before it has work to do
+    void PollSensorTask::arm_session_timer()
+    {
+        auto now = steady_clock::now();
+        auto next = bus_scheduler.get_next_run_time(now);
 
-            envir_value.set_temperture_degree_C(temperature);
-            envir_value.set_relative_humidity(humidity);
+        if (has_reading && next_record_time < next)
+        {
+            next = next_record_time;
+        }
 
+        // without a sensor or a reading the tick keeps looking once a minute
+        if (next != steady_clock::time_point::max())
+        {
+            auto delay = duration_cast<milliseconds>(next - now) + milliseconds(1);
+            session_timer->start(delay);
+        }
+    }
+
+    // Set the next DHT12 period from the rate of change of the burst medians and publish the
+    // filtered reading as an EnvirValue if it is outside the deadband of the last published
+    // reading.  The EWMA output only moves a quarter of the way on the first burst of a
+    // change, so it shows the start of a ramp at about a quarter of its rate.
+    void PollSensorTask::handle_dht12_reading(steady_clock::time_point now, const MultiChannelSample& sample)
+    {
+        float temperature = 0;
+        float humidity = 0;
+        sample.find(MultiChannelSample::Quantity::TemperatureDegreeC, temperature);
+        sample.find(MultiChannelSample::Quantity::RelativeHumidity, humidity);
+
+        latest_sample = PackedSample::pack(temperature, humidity);
+        has_reading = true;
+        dht12.set_period(poll_policy.next_interval(now, dht12.get_last_median()));
+
+        if (poll_policy.should_publish(latest_sample))
+        {
+            envir_value.set_temperture_degree_C(latest_sample.get_temperature_degree_C());
+            envir_value.set_relative_humidity(latest_sample.get_relative_humidity());
+
+            TraceRing::record(TraceEventType::Publish, 0);
             Publisher<EnvirValue>::publish(envir_value);
         }
     }
+
+    // Record the latest reading on the fixed 30 sec grid the history, statistics and log expect,
+    // a reading is held until the next one when the read interval is longer
+    void PollSensorTask::record_sample(const PackedSample& sample)
+    {
+        history->append(sample);
+        update_rolling_stats(sample);
+
+        // the statistics change with every recorded sample, not only when the value leaves the deadband
+        Publisher<EnvirStats>::publish(envir_stats);
+
+        // the flash write can stall for tens of milliseconds so it is done by SampleLogTask
+        auto uptime = duration_cast<seconds>(steady_clock::now().time_since_epoch());
+        Publisher<SampleLog::Record>::publish(SampleLog::Record{ static_cast<uint32_t>(uptime.count()), sample });
+    }
 }
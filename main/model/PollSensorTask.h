@@ -16,30 +16,112 @@
  ***************************************************************************************/
 #pragma once
 
+#include "model/AdaptivePollPolicy.h"
+#include "model/BusScheduler.h"
+#include "model/DHT12Sensor.h"
 #include "model/EnvirValue.h"
+#include "model/EnvirStats.h"
+#include "model/MultiChannelSample.h"
+#include "model/RollingStats.h"
+#include "model/SampleHistory.h"
+#include "model/I2CBus.h"
+#include "model/SampleLog.h"
+#include <memory>
 #include <smooth/core/Task.h>
 #include <smooth/core/ipc/IEventListener.h>
 #include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+#include <smooth/core/ipc/TaskEventQueue.h>
+#include <smooth/core/timer/Timer.h>
+#include <smooth/core/timer/TimerExpiredEvent.h>
 #include <smooth/core/io/i2c/Master.h>
 #include <smooth/application/io/i2c/DHT12.h>
 
 namespace redstone
 {
-    class PollSensorTask : public smooth::core::Task
+    class PollSensorTask : public smooth::core::Task,
+                           public smooth::core::ipc::IEventListener<smooth::core::timer::TimerExpiredEvent>
     {
         public:
+            // 24 hours of samples taken every 30 seconds
+            static constexpr size_t HistoryLength = 24 * 60 * 2;
+            using History = SampleHistory<HistoryLength>;
+
+            // 1 hour of 30 second samples and 24 hours in 5 minute slots
+            struct RollingStatsWindows
+            {
+                RollingWindow<120, 1> temperature_hour;
+                RollingWindow<120, 1> humidity_hour;
+                RollingWindow<288, 10> temperature_day;
+                RollingWindow<288, 10> humidity_day;
+            };
+
+            // The sensors on the I2C bus, more sensors are added with bus_scheduler.add_sensor
+            static constexpr size_t MaxSensors = 4;
+
             PollSensorTask();
 
             void init() override;
 
             void tick() override;
 
+            /// The session timer expired event, a sensor step or a recorded sample is due
+            void event(const smooth::core::timer::TimerExpiredEvent& event) override;
+
+            /// Get the DHT12 acquisition and its counters
+            const DHT12Acquisition& get_acquisition() const
+            {
+                return dht12.get_acquisition();
+            }
+
+            /// Get the I2C bus and its clock speed statistics
+            const I2CBus& get_i2c_bus() const
+            {
+                return i2c_bus;
+            }
+
+            /// Get the bus scheduler and its counters
+            const BusScheduler<MaxSensors>& get_bus_scheduler() const
+            {
+                return bus_scheduler;
+            }
+
+            /// Get the adaptive poll policy and its counters
+            const AdaptivePollPolicy& get_poll_policy() const
+            {
+                return poll_policy;
+            }
+
         private:
             bool init_i2c_dht12();
+            void run_session();
+            void arm_session_timer();
+            void handle_dht12_reading(std::chrono::steady_clock::time_point now, const MultiChannelSample& sample);
+            void record_sample(const PackedSample& sample);
+            void update_rolling_stats(const PackedSample& sample);
+
+            using ExpiredQueue = smooth::core::ipc::TaskEventQueue<smooth::core::timer::TimerExpiredEvent>;
+            std::shared_ptr<ExpiredQueue> session_timer_queue;
+            smooth::core::timer::TimerOwner session_timer;
 
             smooth::core::io::i2c::Master i2c_master;
             std::unique_ptr<smooth::application::sensor::DHT12> sensor{};
             bool dht12_initialized{ false };
+
+            // The measurements bypass the smooth DHT12 device so every transfer has a bounded time
+            I2CBus i2c_bus{ I2C_NUM_0 };
+            DHT12Sensor dht12{ i2c_bus, 0x5C };
+            BusScheduler<MaxSensors> bus_scheduler{ std::chrono::seconds(5) };
+
+            AdaptivePollPolicy poll_policy{ AdaptivePollPolicy::Config{} };
+            PackedSample latest_sample{};
+            bool has_reading{ false };
+            std::chrono::steady_clock::time_point next_record_time{};
             EnvirValue envir_value{};
+
+            // About 11.5 KB so it is kept on the heap and not in the task that owns this object
+            std::unique_ptr<History> history{};
+
+            std::unique_ptr<RollingStatsWindows> rolling_stats{};
+            EnvirStats envir_stats{};
     };
 }
@@ -0,0 +1,173 @@
+/****************************************************************************************
+ * RollingStats.h - Rolling min, max and mean over a fixed window with O(1) cost per sample
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace redstone
+{
+    // The result of a rolling window
+    struct RollingResult
+    {
+        int16_t min;
+        int16_t max;
+        int32_t sum;
+        uint32_t count;
+    };
+
+    // A fixed size deque that keeps the values of a window in monotonic order so its front
+    // is always the min (IsMin = true) or the max (IsMin = false) of the window.  Each value
+    // is pushed and popped at most once, that is amortized O(1) per value.
+    template<size_t Capacity, bool IsMin>
+    class MonotonicDeque
+    {
+        public:
+            /// Push the value of a slot, values it dominates are dropped from the back.  The
+            /// slots that left the window must be expired first to make room.
+            /// \param slot The sequence number of the slot, wraps at 65536
+            /// \param value The value of the slot
+            void push(uint16_t slot, int16_t value)
+            {
+                while (count > 0 && dominates(value, entries[back_index()].value))
+                {
+                    count--;
+                }
+
+                entries[(front + count) % Capacity] = Entry{ slot, value };
+                count++;
+            }
+
+            /// Drop the values of slots that are no longer in the window
+            /// \param newest_slot The sequence number of the newest slot
+            void expire(uint16_t newest_slot)
+            {
+                while (count > 0 && static_cast<uint16_t>(newest_slot - entries[front].slot) >= Capacity)
+                {
+                    front = (front + 1) % Capacity;
+                    count--;
+                }
+            }
+
+            bool empty() const
+            {
+                return count == 0;
+            }
+
+            /// Get the min or max of the window, only valid when not empty
+            int16_t value() const
+            {
+                return entries[front].value;
+            }
+
+        private:
+            struct Entry
+            {
+                uint16_t slot;
+                int16_t value;
+            };
+
+            static bool dominates(int16_t value, int16_t other)
+            {
+                return IsMin ? value <= other : value >= other;
+            }
+
+            size_t back_index() const
+            {
+                return (front + count - 1) % Capacity;
+            }
+
+            std::array<Entry, Capacity> entries{};
+            size_t front{ 0 };
+            size_t count{ 0 };
+    };
+
+    // Samples are collected into slots of SamplesPerSlot samples and the window holds the
+    // last Slots complete slots plus the slot being filled.  A longer window with coarser
+    // slots costs the same per sample and less memory, e.g. 24 h of 30 s samples as 288
+    // slots of 5 minutes instead of 2880 single sample slots.
+    template<size_t Slots, size_t SamplesPerSlot>
+    class RollingWindow
+    {
+        public:
+            static_assert(Slots < 32768, "Slot sequence numbers must not wrap inside the window");
+
+            /// Add a sample
+            /// \param value The sample value
+            void add(int16_t value)
+            {
+                slot_min = slot_count == 0 || value < slot_min ? value : slot_min;
+                slot_max = slot_count == 0 || value > slot_max ? value : slot_max;
+                slot_sum += value;
+                slot_count++;
+
+                if (slot_count == SamplesPerSlot)
+                {
+                    close_slot();
+                }
+            }
+
+            /// Get the min, max, sum and number of samples in the window
+            RollingResult get() const
+            {
+                RollingResult result{ slot_min, slot_max, slot_sum + window_sum,
+                                      static_cast<uint32_t>(slot_count + filled_slots * SamplesPerSlot) };
+
+                if (!min_deque.empty())
+                {
+                    result.min = slot_count == 0 || min_deque.value() < result.min ? min_deque.value() : result.min;
+                    result.max = slot_count == 0 || max_deque.value() > result.max ? max_deque.value() : result.max;
+                }
+
+                return result;
+            }
+
+        private:
+            void close_slot()
+            {
+                slot_sequence++;
+
+                // the running sum drops the slot that falls out of the window
+                if (filled_slots == Slots)
+                {
+                    window_sum -= slot_sums[slot_position];
+                }
+                else
+                {
+                    filled_slots++;
+                }
+
+                slot_sums[slot_position] = slot_sum;
+                window_sum += slot_sum;
+                slot_position = (slot_position + 1) % Slots;
+
+                // expire first, a full deque of a monotonic run has no room for the new slot
+                min_deque.expire(slot_sequence);
+                min_deque.push(slot_sequence, slot_min);
+                max_deque.expire(slot_sequence);
+                max_deque.push(slot_sequence, slot_max);
+
+                slot_sum = 0;
+                slot_count = 0;
+            }
+
+            MonotonicDeque<Slots, true> min_deque{};
+            MonotonicDeque<Slots, false> max_deque{};
+            std::array<int32_t, Slots> slot_sums{};
+            int32_t window_sum{ 0 };
+            size_t filled_slots{ 0 };
+            size_t slot_position{ 0 };
+            uint16_t slot_sequence{ 0 };
+
+            int16_t slot_min{ 0 };
+            int16_t slot_max{ 0 };
+            int32_t slot_sum{ 0 };
+            size_t slot_count{ 0 };
+    };
+}
@@ -0,0 +1,112 @@
+/****************************************************************************************
+ * SampleFilter.h - Median of N outlier rejection and EWMA decimation of oversampled readings
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "model/SampleHistory.h"
+
+namespace redstone
+{
+    // A burst of Oversample raw readings is reduced to one reading: the median of the burst
+    // rejects a single bad reading (for odd Oversample of 3 or more) and an EWMA with
+    // alpha = 1 / 2^EwmaShift smooths the medians of successive bursts.  The EWMA state keeps
+    // FractionBits bits below the 0.1 resolution of the DHT12 so small steps are not lost
+    // to rounding.  Everything is fixed size, nothing is allocated.
+    template<size_t Oversample, int EwmaShift>
+    class SampleFilter
+    {
+        public:
+            static_assert(Oversample % 2 == 1, "The median needs an odd number of readings");
+
+            /// Add a raw reading to the burst
+            /// \param raw The raw reading
+            void add(const PackedSample& raw)
+            {
+                if (count < Oversample)
+                {
+                    temperatures[count] = raw.temperature_deci_c;
+                    humidities[count] = static_cast<int16_t>(raw.humidity_deci);
+                    count++;
+                }
+            }
+
+            /// Check if the burst has all its readings
+            bool is_complete() const
+            {
+                return count == Oversample;
+            }
+
+            /// Drop the readings of an incomplete burst, the EWMA state is kept
+            void reset_burst()
+            {
+                count = 0;
+            }
+
+            /// Reduce the complete burst to one filtered reading and start a new burst
+            /// \return Returns the filtered reading
+            PackedSample decimate()
+            {
+                int32_t temperature = median(temperatures);
+                int32_t humidity = median(humidities);
+                last_median = PackedSample{ static_cast<int16_t>(temperature), static_cast<uint16_t>(humidity) };
+
+                if (!has_state)
+                {
+                    temperature_state = temperature * FractionScale;
+                    humidity_state = humidity * FractionScale;
+                    has_state = true;
+                }
+                else
+                {
+                    temperature_state += (temperature * FractionScale - temperature_state) / (1 << EwmaShift);
+                    humidity_state += (humidity * FractionScale - humidity_state) / (1 << EwmaShift);
+                }
+
+                count = 0;
+
+                return PackedSample{ static_cast<int16_t>(round_state(temperature_state)),
+                                     static_cast<uint16_t>(round_state(humidity_state)) };
+            }
+
+            /// Get the median of the last complete burst, before the EWMA
+            /// \return Returns the median reading
+            const PackedSample& get_last_median() const
+            {
+                return last_median;
+            }
+
+        private:
+            static constexpr int FractionBits = 4;
+            static constexpr int32_t FractionScale = 1 << FractionBits;
+
+            static int16_t median(const std::array<int16_t, Oversample>& readings)
+            {
+                std::array<int16_t, Oversample> sorted = readings;
+                std::nth_element(sorted.begin(), sorted.begin() + Oversample / 2, sorted.end());
+                return sorted[Oversample / 2];
+            }
+
+            static int32_t round_state(int32_t state)
+            {
+                return state >= 0 ? (state + FractionScale / 2) / FractionScale
+                                  : -((-state + FractionScale / 2) / FractionScale);
+            }
+
+            std::array<int16_t, Oversample> temperatures{};
+            std::array<int16_t, Oversample> humidities{};
+            size_t count{ 0 };
+
+            int32_t temperature_state{ 0 };
+            int32_t humidity_state{ 0 };
+            bool has_state{ false };
+            PackedSample last_median{};
+    };
+}
@@ -0,0 +1,175 @@
+/****************************************************************************************
+ * SampleHistory.h - A fixed size ring of packed temperature and humidity samples
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace redstone
+{
+    // A sample stores the temperature and the humidity in tenths as 16 bit integers, that is
+    // 4 bytes per sample instead of 8 for two floats.  The DHT12 only resolves 0.1 degC and
+    // 0.1 %RH so nothing is lost.
+    struct PackedSample
+    {
+        int16_t temperature_deci_c;
+        uint16_t humidity_deci;
+
+        /// Pack a temperature and humidity
+        /// \param temp_deg_c The temperature in degree celsius
+        /// \param humidity The relative humidity in percent
+        /// \return Returns the packed sample
+        static PackedSample pack(float temp_deg_c, float humidity)
+        {
+            return PackedSample{ static_cast<int16_t>(lroundf(temp_deg_c * 10.0f)),
+                                 static_cast<uint16_t>(lroundf(humidity * 10.0f)) };
+        }
+
+        /// Get the temperature in degree celsius
+        float get_temperature_degree_C() const
+        {
+            return temperature_deci_c * 0.1f;
+        }
+
+        /// Get the relative humidity in percent
+        float get_relative_humidity() const
+        {
+            return humidity_deci * 0.1f;
+        }
+    };
+
+    static_assert(sizeof(PackedSample) == 4, "PackedSample must stay 4 bytes");
+
+    // The oldest sample is overwritten once the history is full.  The iterator walks from the
+    // oldest to the newest sample.
+    template<size_t Capacity>
+    class SampleHistory
+    {
+        public:
+            class Iterator
+            {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = PackedSample;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const PackedSample*;
+                    using reference = const PackedSample&;
+
+                    Iterator(const SampleHistory& history, size_t position) : history(&history), position(position)
+                    {
+                    }
+
+                    const PackedSample& operator*() const
+                    {
+                        return (*history)[position];
+                    }
+
+                    const PackedSample* operator->() const
+                    {
+                        return &(*history)[position];
+                    }
+
+                    Iterator& operator++()
+                    {
+                        position++;
+                        return *this;
+                    }
+
+                    Iterator operator++(int)
+                    {
+                        Iterator previous = *this;
+                        position++;
+                        return previous;
+                    }
+
+                    bool operator==(const Iterator& other) const
+                    {
+                        return position == other.position;
+                    }
+
+                    bool operator!=(const Iterator& other) const
+                    {
+                        return position != other.position;
+                    }
+
+                private:
+                    const SampleHistory* history;
+                    size_t position;
+            };
+
+            /// Append a sample, overwriting the oldest sample when full
+            /// \param sample The sample to append
+            void append(const PackedSample& sample)
+            {
+                samples[head] = sample;
+                head = head + 1 == Capacity ? 0 : head + 1;
+                count = count < Capacity ? count + 1 : Capacity;
+            }
+
+            /// Get a sample
+            /// \param position The position of the sample, 0 is the oldest sample
+            /// \return Returns the sample
+            const PackedSample& operator[](size_t position) const
+            {
+                size_t index = oldest() + position;
+                return samples[index >= Capacity ? index - Capacity : index];
+            }
+
+            /// Get the newest sample, only valid when the history is not empty
+            const PackedSample& newest() const
+            {
+                return samples[head == 0 ? Capacity - 1 : head - 1];
+            }
+
+            /// Get the number of samples in the history
+            size_t size() const
+            {
+                return count;
+            }
+
+            /// Get the maximum number of samples in the history
+            static constexpr size_t capacity()
+            {
+                return Capacity;
+            }
+
+            bool empty() const
+            {
+                return count == 0;
+            }
+
+            void clear()
+            {
+                head = 0;
+                count = 0;
+            }
+
+            Iterator begin() const
+            {
+                return Iterator(*this, 0);
+            }
+
+            Iterator end() const
+            {
+                return Iterator(*this, count);
+            }
+
+        private:
+            size_t oldest() const
+            {
+                return count < Capacity ? 0 : head;
+            }
+
+            std::array<PackedSample, Capacity> samples{};
+            size_t head{ 0 };
+            size_t count{ 0 };
+    };
+}
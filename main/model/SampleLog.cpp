@@ -0,0 +1,204 @@
+/****************************************************************************************
+ * SampleLog.cpp - An append only log of samples written to flash in whole sectors
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include "model/SampleLog.h"
+#include <algorithm>
+#include <chrono>
+#include <unistd.h>
+
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Constructor
+    SampleLog::SampleLog(std::string directory, size_t max_file_bytes) :
+            directory(std::move(directory)),
+            max_file_bytes(max_file_bytes - max_file_bytes % SectorSize)
+    {
+    }
+
+    // Destructor
+    SampleLog::~SampleLog()
+    {
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+    }
+
+    // Open the current log file, continuing the newest of the two files
+    bool SampleLog::open()
+    {
+        size_t sizes[2];
+        uint16_t sequences[2];
+        bool marked[2] = { read_file_marker(0, sizes[0], sequences[0]), read_file_marker(1, sizes[1], sequences[1]) };
+
+        // the newest file has the higher sequence number, the difference is taken as signed so
+        // the numbers may wrap around
+        int newest = -1;
+
+        if (marked[0] && marked[1])
+        {
+            newest = static_cast<int16_t>(sequences[1] - sequences[0]) > 0 ? 1 : 0;
+        }
+        else if (marked[0] || marked[1])
+        {
+            newest = marked[0] ? 0 : 1;
+        }
+
+        bool opened;
+
+        if (newest < 0)
+        {
+            opened = start_file(0, 0);
+        }
+        else if (sizes[newest] < max_file_bytes)
+        {
+            opened = open_file(newest, "ab");
+            file_sequence = sequences[newest];
+        }
+        else
+        {
+            // the newest file is full, the other file holds the oldest samples
+            opened = start_file(1 - newest, static_cast<uint16_t>(sequences[newest] + 1));
+        }
+
+        if (!opened)
+        {
+            return false;
+        }
+
+        // the uptime of the samples that follow starts over at this boot
+        append(BootMarker, PackedSample{});
+        return true;
+    }
+
+    // Append a sample
+    void SampleLog::append(uint32_t time_s, const PackedSample& sample)
+    {
+        // the older file is only truncated when the first record for it arrives, its file
+        // marker goes first in the sector
+        if (buffered == 0 && file != nullptr && file_bytes >= max_file_bytes)
+        {
+            start_file(1 - file_index, static_cast<uint16_t>(file_sequence + 1));
+        }
+
+        buffer[buffered++] = Record{ time_s, sample };
+
+        if (buffered == RecordsPerSector)
+        {
+            write_sector();
+        }
+    }
+
+    // Write the partly filled sector
+    void SampleLog::flush()
+    {
+        if (buffered > 0)
+        {
+            // the next write has to start on a sector boundary again so the rest of the sector
+            // is padded with empty records
+            std::fill(buffer.begin() + buffered, buffer.end(), Record{ PaddingTime, PackedSample{} });
+            write_sector();
+        }
+    }
+
+    // Get the path of a log file
+    std::string SampleLog::file_path(int index) const
+    {
+        return directory + (index == 0 ? "/samples0.log" : "/samples1.log");
+    }
+
+    // Get the size of a log file and the sequence number of its file marker
+    bool SampleLog::read_file_marker(int index, size_t& size, uint16_t& sequence) const
+    {
+        FILE* f = fopen(file_path(index).c_str(), "rb");
+        Record first{};
+        size = 0;
+        sequence = 0;
+
+        if (f == nullptr)
+        {
+            return false;
+        }
+
+        bool marked = fread(&first, sizeof(first), 1, f) == 1 && first.time_s == FileMarker;
+        fseek(f, 0, SEEK_END);
+        size = static_cast<size_t>(ftell(f));
+        fclose(f);
+
+        sequence = first.sample.humidity_deci;
+        return marked;
+    }
+
+    // Open a log file
+    bool SampleLog::open_file(int index, const char* mode)
+    {
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+
+        file_index = index;
+        file = fopen(file_path(index).c_str(), mode);
+        file_bytes = 0;
+
+        if (file != nullptr)
+        {
+            // no stdio buffering, each fwrite goes to FATFS as one whole sector
+            setvbuf(file, nullptr, _IONBF, 0);
+            fseek(file, 0, SEEK_END);
+            file_bytes = static_cast<size_t>(ftell(file));
+        }
+
+        return file != nullptr;
+    }
+
+    // Truncate a log file and start it with a file marker, the sector buffer must be empty
+    bool SampleLog::start_file(int index, uint16_t sequence)
+    {
+        file_sequence = sequence;
+        buffer[buffered++] = Record{ FileMarker, PackedSample{ 0, sequence } };
+        return open_file(index, "wb");
+    }
+
+    // Write the buffered sector
+    void SampleLog::write_sector()
+    {
+        buffered = 0;
+
+        if (file == nullptr)
+        {
+            write_errors++;
+            return;
+        }
+
+        auto start = steady_clock::now();
+
+        size_t written = fwrite(buffer.data(), 1, SectorSize, file);
+
+        // commit the file size to the directory entry so the sector survives a power loss
+        fflush(file);
+        fsync(fileno(file));
+
+        auto stall = static_cast<uint32_t>(duration_cast<microseconds>(steady_clock::now() - start).count());
+
+        write_stall_us += stall;
+        max_write_stall_us = stall > max_write_stall_us ? stall : max_write_stall_us.load();
+
+        if (written == SectorSize)
+        {
+            bytes_written += SectorSize;
+            erase_count++;
+            file_bytes += SectorSize;
+        }
+        else
+        {
+            write_errors++;
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/****************************************************************************************
+ * SampleLog.h - An append only log of samples written to flash in whole sectors
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "model/SampleHistory.h"
+
+namespace redstone
+{
+    // Samples are collected in a RAM buffer of one wear levelling sector and written with a
+    // single fwrite once the buffer is full, so every write to flash is one whole, aligned
+    // sector.  The log alternates between two files and truncates the older one when the
+    // current file reaches max_file_bytes, so the newest samples are always kept.
+    //
+    // Every file starts with a file marker record that holds a sequence number one higher
+    // than the one of the other file, open() compares them to find the newest file.  The
+    // record times are uptimes, open() writes a boot marker record so a reader can tell
+    // where the uptime starts over.  Only standard C and C++ library calls are used so the
+    // class also runs on a host against a plain directory.
+    class SampleLog
+    {
+        public:
+            static constexpr size_t SectorSize = 4096;
+
+            // The time of the padding records flush() writes, of the record open() writes and
+            // of the first record of a file, whose humidity holds the sequence number of the file
+            static constexpr uint32_t PaddingTime = 0;
+            static constexpr uint32_t BootMarker = UINT32_MAX;
+            static constexpr uint32_t FileMarker = UINT32_MAX - 1;
+
+            struct Record
+            {
+                uint32_t time_s;        // seconds since the last boot marker
+                PackedSample sample;
+            };
+
+            static_assert(SectorSize % sizeof(Record) == 0, "A sector must hold a whole number of records");
+
+            static constexpr size_t RecordsPerSector = SectorSize / sizeof(Record);
+
+            /// Constructor
+            /// \param directory The directory the log files are created in, e.g. the mount point
+            /// \param max_file_bytes The size of one log file before the log switches to the other file
+            SampleLog(std::string directory, size_t max_file_bytes);
+
+            ~SampleLog();
+
+            /// Open the newest log file, or start the other file when it is full, and append a
+            /// boot marker
+            /// \return Returns true if the file could be opened
+            bool open();
+
+            /// Append a sample, the sector is written to flash when it is full
+            /// \param time_s The time of the sample in seconds
+            /// \param sample The sample
+            void append(uint32_t time_s, const PackedSample& sample);
+
+            /// Write the partly filled sector, this costs an extra sector erase so only call it
+            /// before a planned shutdown
+            void flush();
+
+            /// Get the number of bytes written to flash
+            uint32_t get_bytes_written() const
+            {
+                return bytes_written;
+            }
+
+            /// Get the number of data sectors written, each costs one erase of the wear levelled
+            /// flash, the FAT and directory entry updates made by fsync are not included
+            uint32_t get_erase_count() const
+            {
+                return erase_count;
+            }
+
+            /// Get the total time spent in writes, the calling task is stalled for this time
+            uint32_t get_write_stall_us() const
+            {
+                return write_stall_us;
+            }
+
+            /// Get the longest time a single write stalled the calling task
+            uint32_t get_max_write_stall_us() const
+            {
+                return max_write_stall_us;
+            }
+
+            /// Get the number of writes that failed
+            uint32_t get_write_errors() const
+            {
+                return write_errors;
+            }
+
+        private:
+            std::string file_path(int index) const;
+            bool read_file_marker(int index, size_t& size, uint16_t& sequence) const;
+            bool open_file(int index, const char* mode);
+            bool start_file(int index, uint16_t sequence);
+            void write_sector();
+
+            std::string directory;
+            size_t max_file_bytes;
+            FILE* file{ nullptr };
+            int file_index{ 0 };
+            uint16_t file_sequence{ 0 };
+            size_t file_bytes{ 0 };
+
+            std::array<Record, RecordsPerSector> buffer{};
+            size_t buffered{ 0 };
+
+            std::atomic<uint32_t> bytes_written{ 0 };
+            std::atomic<uint32_t> erase_count{ 0 };
+            std::atomic<uint32_t> write_stall_us{ 0 };
+            std::atomic<uint32_t> max_write_stall_us{ 0 };
+            std::atomic<uint32_t> write_errors{ 0 };
+    };
+}
@@ -0,0 +1,86 @@
+/****************************************************************************************
+ * SampleLogTask.cpp - Writes the sample log to flash at a low priority
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#include "model/SampleLogTask.h"
+#include <smooth/core/logging/log.h>
+#include <esp_vfs_fat.h>
+#include <wear_levelling.h>
+
+using namespace std::chrono;
+using namespace smooth::core;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SampleLogTask";
+    static const char* StorageMountPoint = "/app_storage";
+    static const char* StoragePartition = "app_storage";
+    static constexpr size_t SampleLogFileBytes = 192 * 1024;   // two files fit in the 528k partition
+
+    // Constructor
+    SampleLogTask::SampleLogTask() :
+            smooth::core::Task("SampleLogTask", 4096, 5, seconds(60)),
+
+            // The Task Name = "SampleLogTask"
+            // The stack size is 4096 bytes for the FATFS and wear levelling write path
+            // The priority is set to 5, below PollSensorTask and LvglTask
+            // The tick interval is 60 sec, the task only wakes up for records
+
+            subr_queue_record(SubQRecord::create(8, *this, *this))
+
+            // Create Subscriber Queue (SubQ) so this task receives the records PollSensorTask
+            // publishes, the queue holds 4 minutes of records while a write is stalled
+    {
+    }
+
+    // Initialize the Task
+    void SampleLogTask::init()
+    {
+        Log::info(TAG, "Sample log intialization --- {}", init_sample_log() ? "Succeeded" : "Failed");
+    }
+
+    // Append a recorded sample, a full sector is written to flash from here
+    void SampleLogTask::event(const SampleLog::Record& record)
+    {
+        if (sample_log)
+        {
+            sample_log->append(record.time_s, record.sample);
+        }
+    }
+
+    // Mount the app_storage FAT partition and open the sample log
+    bool SampleLogTask::init_sample_log()
+    {
+        esp_vfs_fat_mount_config_t mount_config{};
+        mount_config.format_if_mount_failed = true;
+        mount_config.max_files = 2;
+        mount_config.allocation_unit_size = SampleLog::SectorSize;
+
+        wl_handle_t wl_handle = WL_INVALID_HANDLE;
+        esp_err_t err = esp_vfs_fat_spiflash_mount(StorageMountPoint, StoragePartition, &mount_config, &wl_handle);
+
+        if (err != ESP_OK)
+        {
+            Log::error(TAG, "Mounting {} failed: {}", StoragePartition, esp_err_to_name(err));
+            return false;
+        }
+
+        auto log = std::make_unique<SampleLog>(StorageMountPoint, SampleLogFileBytes);
+
+        if (log->open())
+        {
+            sample_log = std::move(log);
+        }
+
+        return sample_log != nullptr;
+    }
+}
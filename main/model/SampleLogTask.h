@@ -0,0 +1,53 @@
+/****************************************************************************************
+ * SampleLogTask.h - Writes the sample log to flash at a low priority
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#pragma once
+
+#include <memory>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+#include "model/SampleLog.h"
+
+namespace redstone
+{
+    // PollSensorTask publishes a SampleLog::Record every 30 seconds and this task appends it to
+    // the log.  A full sector is written with fwrite and fsync, which can block for tens of
+    // milliseconds while the wear levelling layer erases, so it runs here at a priority below
+    // the sensor and display tasks and with a stack sized for the FATFS write path.
+    class SampleLogTask : public smooth::core::Task, public smooth::core::ipc::IEventListener<SampleLog::Record>
+    {
+        public:
+            SampleLogTask();
+
+            void init() override;
+
+            /// The event that a sample was recorded
+            /// \param record The record to append to the log
+            void event(const SampleLog::Record& record) override;
+
+            /// Get the sample log, nullptr if the app_storage partition could not be mounted
+            const SampleLog* get_sample_log() const
+            {
+                return sample_log.get();
+            }
+
+        private:
+            bool init_sample_log();
+
+            using SubQRecord = smooth::core::ipc::SubscribingTaskEventQueue<SampleLog::Record>;
+            std::shared_ptr<SubQRecord> subr_queue_record;
+
+            // Holds a 4 KB sector buffer so it is kept on the heap
+            std::unique_ptr<SampleLog> sample_log{};
+    };
+}
@@ -0,0 +1,97 @@
+/****************************************************************************************
+ * TimingHistogram.h - A fixed size histogram of durations in power of two buckets
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace redstone
+{
+    // Bucket 0 counts durations of 0 and bucket b counts durations from 2^(b-1) up to
+    // 2^b - 1, so 33 buckets cover every uint32_t duration.  Recording is two relaxed atomic
+    // updates and nothing is allocated, so it can be used from any task.  It is always
+    // inlined so it runs from IRAM when recorded from an IRAM interrupt handler.  The
+    // percentiles are the upper bound of the bucket they fall in, that is within a factor of two.
+    class TimingHistogram
+    {
+        public:
+            static constexpr int BucketCount = 33;
+
+            struct Summary
+            {
+                uint32_t count;
+                uint32_t p50;
+                uint32_t p99;
+                uint32_t max;
+            };
+
+            /// Record a duration
+            /// \param duration The duration, in any unit
+            __attribute__((always_inline)) inline void record(uint32_t duration)
+            {
+                buckets[bucket_of(duration)].fetch_add(1, std::memory_order_relaxed);
+
+                uint32_t current_max = max.load(std::memory_order_relaxed);
+
+                while (duration > current_max
+                       && !max.compare_exchange_weak(current_max, duration, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            /// Get the summary of the durations recorded since the last call and start over
+            /// \return Returns the count, p50, p99 and max of the durations
+            Summary take_summary()
+            {
+                std::array<uint32_t, BucketCount> counts{};
+                uint32_t total = 0;
+
+                for (int b = 0; b < BucketCount; b++)
+                {
+                    counts[b] = buckets[b].exchange(0, std::memory_order_relaxed);
+                    total += counts[b];
+                }
+
+                uint32_t largest = max.exchange(0, std::memory_order_relaxed);
+
+                return Summary{ total, percentile(counts, total, 50, largest),
+                                percentile(counts, total, 99, largest), largest };
+            }
+
+        private:
+            __attribute__((always_inline)) static inline int bucket_of(uint32_t duration)
+            {
+                return duration == 0 ? 0 : 32 - __builtin_clz(duration);
+            }
+
+            static uint32_t percentile(const std::array<uint32_t, BucketCount>& counts, uint32_t total,
+                                       uint32_t percent, uint32_t largest)
+            {
+                // the rank of the percentile, rounded up so p99 of a few samples is the largest
+                uint64_t rank = (static_cast<uint64_t>(total) * percent + 99) / 100;
+                uint64_t cumulative = 0;
+
+                for (int b = 0; b < BucketCount && total > 0; b++)
+                {
+                    cumulative += counts[b];
+
+                    if (cumulative >= rank)
+                    {
+                        uint32_t upper = b == 0 ? 0 : (b == 32 ? UINT32_MAX : (1u << b) - 1);
+                        return upper < largest ? upper : largest;
+                    }
+                }
+
+                return 0;
+            }
+
+            std::array<std::atomic<uint32_t>, BucketCount> buckets{};
+            std::atomic<uint32_t> max{ 0 };
+    };
+}
@@ -0,0 +1,47 @@
+/****************************************************************************************
+ * TimingStats.cpp - Cycle counter timing of the hot paths, dumped with the system statistics
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ ***************************************************************************************/
+#include "stats/TimingStats.h"
+#include <sdkconfig.h>
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "Timing";
+    static constexpr uint32_t CyclesPerMicrosecond = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+    static constexpr std::array<const char*, TimingStats::ProbeCount> ProbeNames{
+        "lv_task_handler", "PollSensorTask session", "display_drv_flush", "ViewController::event", "MenuPane::event",
+        "view switch frame", "SPI bus gap", "button press redraw"
+    };
+
+    // Class variables, zero initialized in .bss so an interrupt can record before main runs
+    TimingStats TimingStats::stats{};
+
+    // Log the probes as a table like the one of SystemStatistics
+    void TimingStats::dump_and_reset()
+    {
+        Log::info(TAG, "{:>22} | {:>8} | {:>8} | {:>8} | {:>8}", "Name", "Count", "p50 us", "p99 us", "Max us");
+
+        for (int probe = 0; probe < ProbeCount; probe++)
+        {
+            auto summary = take_summary(static_cast<Probe>(probe));
+            Log::info(TAG, "{:>22} | {:>8} | {:>8} | {:>8} | {:>8}", ProbeNames[probe], summary.count,
+                      summary.p50 / CyclesPerMicrosecond, summary.p99 / CyclesPerMicrosecond,
+                      summary.max / CyclesPerMicrosecond);
+        }
+
+        Log::info(TAG, "Discarded, moved to the other core: {}", discarded.exchange(0, std::memory_order_relaxed));
+    }
+}
@@ -0,0 +1,109 @@
+/****************************************************************************************
+ * TimingStats.h - Cycle counter timing of the hot paths, dumped with the system statistics
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <hal/cpu_hal.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "stats/TimingHistogram.h"
+
+namespace redstone
+{
+    class TimingStats
+    {
+        public:
+            enum Probe : int
+            {
+                LvglTaskHandler = 0,
+                PollSensorTick,
+                DisplayFlush,
+                ViewControllerEvent,
+                MenuPaneEvent,
+                DisplayFrame,
+                SpiBusGap,
+                ButtonPressRedraw,
+                ProbeCount
+            };
+
+            /// Get the instance shared by all tasks, it is a constant initialized class variable
+            /// with no guard to take, so interrupt handlers in IRAM can record too
+            __attribute__((always_inline)) static inline TimingStats& instance()
+            {
+                return stats;
+            }
+
+            /// Record a duration, always inlined so it runs from IRAM in an IRAM interrupt handler
+            /// \param probe The code that was timed
+            /// \param cycles The duration in CPU cycles
+            __attribute__((always_inline)) inline void record(Probe probe, uint32_t cycles)
+            {
+                histograms[probe].record(cycles);
+            }
+
+            /// Count a duration that could not be measured, the task moved to the other core
+            void record_discarded()
+            {
+                discarded.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /// Get the summary of a probe since it was last taken and start it over
+            /// \param probe The probe
+            /// \return Returns the count, p50, p99 and max in CPU cycles
+            TimingHistogram::Summary take_summary(Probe probe)
+            {
+                return histograms[probe].take_summary();
+            }
+
+            /// Log count, p50, p99 and max of every probe since the last dump and start over
+            void dump_and_reset();
+
+        private:
+            TimingStats() = default;
+
+            static TimingStats stats;
+
+            std::array<TimingHistogram, ProbeCount> histograms{};
+            std::atomic<uint32_t> discarded{ 0 };
+    };
+
+    // Times the scope it is declared in.  The cycle counters of the two cores are not in
+    // sync, so a duration is discarded when the task was moved to the other core meanwhile.
+    class ScopedTiming
+    {
+        public:
+            explicit ScopedTiming(TimingStats::Probe probe) :
+                    probe(probe), core(xPortGetCoreID()), start(cpu_hal_get_cycle_count())
+            {
+            }
+
+            ~ScopedTiming()
+            {
+                uint32_t end = cpu_hal_get_cycle_count();
+
+                if (xPortGetCoreID() == core)
+                {
+                    TimingStats::instance().record(probe, end - start);
+                }
+                else
+                {
+                    TimingStats::instance().record_discarded();
+                }
+            }
+
+            ScopedTiming(const ScopedTiming&) = delete;
+            ScopedTiming& operator=(const ScopedTiming&) = delete;
+
+        private:
+            TimingStats::Probe probe;
+            int core;
+            uint32_t start;
+    };
+}
@@ -0,0 +1,46 @@
+/****************************************************************************************
+ * TraceRing.cpp - A lock-free ring of typed trace events with esp_timer timestamps
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#include "stats/TraceRing.h"
+#include <algorithm>
+#include <cstring>
+#include <esp_timer.h>
+
+namespace redstone
+{
+    // Class variables, zero initialized in .bss so an interrupt can record before main runs
+    std::array<TraceRing::Event, TraceRing::Capacity> TraceRing::events{};
+    std::atomic<uint32_t> TraceRing::next{ 0 };
+
+    // Write the header and the events, oldest first
+    size_t TraceRing::dump(uint8_t* buffer, size_t size)
+    {
+        if (size < sizeof(Header))
+        {
+            return 0;
+        }
+
+        Header header{};
+        header.magic = Magic;
+        header.version = Version;
+        header.time_us = esp_timer_get_time();
+
+        uint32_t end = next.load(std::memory_order_relaxed);
+        uint32_t count = end < Capacity ? end : Capacity;
+        count = std::min<uint32_t>(count, (size - sizeof(Header)) / sizeof(Event));
+        header.event_count = static_cast<uint16_t>(count);
+
+        memcpy(buffer, &header, sizeof(Header));
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            memcpy(buffer + sizeof(Header) + i * sizeof(Event), &events[(end - count + i) % Capacity], sizeof(Event));
+        }
+
+        return sizeof(Header) + count * sizeof(Event);
+    }
+}
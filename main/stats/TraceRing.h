@@ -0,0 +1,96 @@
+/****************************************************************************************
+ * TraceRing.h - A lock-free ring of typed trace events with esp_timer timestamps
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+namespace redstone
+{
+    // The events that make up a sensor to pixel timeline
+    enum class TraceEventType : uint8_t
+    {
+        SampleRead = 1,     // arg: sensor id
+        Publish,            // arg: 0 EnvirValue
+        QueueReceive,       // arg: 0 EnvirValue in ViewController, 1 button edge in MenuPane
+        LabelSet,           // arg: view id
+        FlushStart,         // arg: first page
+        FlushEnd,           // arg: last page
+        ButtonEdge,         // arg: button id, bit 8 set when pressed
+        FlushDone           // arg: 0, the last transaction of a flush is out on the SPI bus
+    };
+
+    // Published, e.g. by the gui, to have App log the trace ring right away
+    struct TraceDumpRequest
+    {
+    };
+
+    // A slot is claimed with a single atomic fetch_add so any task on either core, and any
+    // interrupt, can record without a lock.  The oldest events are overwritten.  A dump taken
+    // while events are being recorded may contain a half written event, the decoder drops
+    // events with an unknown type.
+    //
+    // The timestamp is the low 32 bits of esp_timer_get_time(), which is in IRAM and is one
+    // time line for both cores.  It wraps every 2^32 us (about 71.6 min), the dump holds the
+    // full esp_timer time it was taken at so the decoder can unwrap the events back from it
+    // as long as consecutive events are less than half a wrap apart.
+    class TraceRing
+    {
+        public:
+            static constexpr size_t Capacity = 512;
+            static constexpr uint32_t Magic = 0x31435254;       // "TRC1"
+            static constexpr uint16_t Version = 2;
+
+            struct Event
+            {
+                uint32_t time_us;
+                uint8_t type;
+                uint8_t core;
+                uint16_t arg;
+            };
+
+            struct Header
+            {
+                uint32_t magic;
+                uint16_t version;
+                uint16_t event_count;
+                int64_t time_us;
+            };
+
+            static_assert(sizeof(Event) == 8, "The dump format has 8 byte events");
+            static_assert(sizeof(Header) == 16, "The dump format has a 16 byte header");
+
+            static constexpr size_t MaxDumpSize = sizeof(Header) + Capacity * sizeof(Event);
+
+            /// Record an event, callable from tasks and interrupts, it is always inlined so it
+            /// runs from IRAM when called from an IRAM interrupt handler
+            /// \param type The type of the event
+            /// \param arg The argument of the event
+            __attribute__((always_inline)) static inline void record(TraceEventType type, uint16_t arg = 0)
+            {
+                auto time_us = static_cast<uint32_t>(esp_timer_get_time());
+                uint32_t slot = next.fetch_add(1, std::memory_order_relaxed) % Capacity;
+                events[slot] = Event{ time_us, static_cast<uint8_t>(type), static_cast<uint8_t>(xPortGetCoreID()), arg };
+            }
+
+            /// Write the events, oldest first, behind a header to a buffer
+            /// \param buffer The buffer for the dump
+            /// \param size The size of the buffer, MaxDumpSize holds a full ring
+            /// \return Returns the number of bytes written
+            static size_t dump(uint8_t* buffer, size_t size);
+
+        private:
+            static std::array<Event, Capacity> events;
+            static std::atomic<uint32_t> next;
+    };
+}
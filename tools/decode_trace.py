@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Decode a TraceRing dump into a Chrome trace (chrome://tracing or https://ui.perfetto.dev).
+
+The input is either the serial log with the "TRACE" lines written by App::dump_trace,
+which is written after a 3 second press of the menu button, or the raw binary dump.
+
+    python3 tools/decode_trace.py monitor.log > trace.json
+"""
+
+import json
+import re
+import struct
+import sys
+
+MAGIC = 0x31435254
+VERSION = 2
+HEADER = struct.Struct("<IHHq")
+EVENT = struct.Struct("<IBBH")
+
+EVENT_NAMES = {
+    1: "sample read",
+    2: "publish",
+    3: "queue receive",
+    4: "label set",
+    5: "flush start",
+    6: "flush end",
+    7: "button edge",
+    8: "flush done",
+}
+
+FLUSH_START = 5
+FLUSH_END = 6
+BUTTON_EDGE = 7
+
+
+def read_blob(data):
+    """Return the binary dump from a raw dump or from the hex lines of a log"""
+    if len(data) >= 4 and struct.unpack_from("<I", data)[0] == MAGIC:
+        return data
+
+    # only the lines of the last dump in the log are used
+    blob = bytearray()
+    for line in data.decode("utf-8", errors="replace").splitlines():
+        if "TRACE BEGIN" in line:
+            blob = bytearray()
+            continue
+        match = re.search(r"TRACE ([0-9a-f]+)\s*$", line)
+        if match:
+            blob += bytes.fromhex(match.group(1))
+    return bytes(blob)
+
+
+def decode(blob):
+    """Return the Chrome trace events of a dump"""
+    magic, version, count, dump_time_us = HEADER.unpack_from(blob, 0)
+    if magic != MAGIC:
+        raise ValueError("not a TraceRing dump")
+    if version != VERSION:
+        raise ValueError("TraceRing dump version {}, this decoder reads version {}".format(version, VERSION))
+
+    events = [EVENT.unpack_from(blob, HEADER.size + i * EVENT.size) for i in range(count)]
+
+    # the events have the low 32 bits of esp_timer, walk back from the time of the dump and
+    # unwrap them.  The difference is signed since an event can be stamped a little before
+    # the event in the slot ahead of it, so consecutive events must be less than half a wrap
+    # (about 35.8 min) apart.
+    times = [None] * len(events)
+    previous_us = dump_time_us
+    for i in reversed(range(len(events))):
+        time_us, event_type, _, _ = events[i]
+        if event_type not in EVENT_NAMES:
+            continue    # a half written event
+        delta = (previous_us - time_us) & 0xFFFFFFFF
+        previous_us -= delta - (1 << 32) if delta >= 1 << 31 else delta
+        times[i] = previous_us
+
+    trace = []
+    for (_, event_type, core, arg), ts in zip(events, times):
+        if event_type not in EVENT_NAMES or ts is None:
+            continue    # a half written event
+
+        event = {"name": EVENT_NAMES[event_type], "ts": ts, "pid": 0, "tid": core, "args": {"arg": arg}}
+
+        if event_type == FLUSH_START:
+            event.update(name="flush", ph="B", args={"first page": arg})
+        elif event_type == FLUSH_END:
+            event.update(name="flush", ph="E", args={"last page": arg})
+        else:
+            event.update(ph="i", s="t")
+            if event_type == BUTTON_EDGE:
+                event["args"] = {"button": arg & 0xFF, "pressed": bool(arg & 0x100)}
+
+        trace.append(event)
+
+    trace.sort(key=lambda e: e["ts"])
+    return trace
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: decode_trace.py <monitor log or binary dump>")
+
+    with open(sys.argv[1], "rb") as f:
+        blob = read_blob(f.read())
+
+    trace = decode(blob)
+    metadata = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": core, "args": {"name": "core {}".format(core)}}
+                for core in (0, 1)]
+    json.dump({"traceEvents": metadata + trace, "displayTimeUnit": "ms"}, sys.stdout, indent=1)
+
+
+if __name__ == "__main__":
+    main()
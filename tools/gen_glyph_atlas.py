@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""Prerender the readout glyphs of an LVGL font into an SH1107 page-major glyph atlas.
+
+Each glyph is rendered into a cell one advance wide and one line high.  In landscape the
+SH1107 pages run along x, so a 16 pixel wide cell is 2 pages of 14 columns (rows in y), and
+bit b of a byte is the pixel at x = page * 8 + b, the same layout DisplayDriver::set_px_cb
+writes.  The rendering is checked against the glyph pictures in the comments of the font.
+
+The generated header is committed.  Regenerate it after changing the font or this script:
+
+    python3 tools/gen_glyph_atlas.py main/fonts/lv_font_14x14B_latin1_sup.c main/fonts/ReadoutGlyphAtlas.h
+
+The build runs it with --check, which fails if the committed header is not what the font and
+this script generate, instead of rewriting a file in the source tree.
+"""
+
+import argparse
+import re
+import sys
+
+# The characters a readout can show, the first one is also used for unknown characters
+GLYPHS = " -.0123456789%°CFHR"
+
+HEADER = """\
+/****************************************************************************************
+ * ReadoutGlyphAtlas.h - The readout glyphs of {font} in SH1107 page layout
+ *
+ * Generated by tools/gen_glyph_atlas.py from {font}.c, do not edit
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2026 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace redstone
+{{
+    // A cell is CellPages pages of CellColumns columns, stored page after page.  Bit b of a
+    // byte is the pixel at x = page * 8 + b of the cell (landscape), 1 is lit.
+    struct ReadoutGlyphAtlas
+    {{
+        static constexpr int CellWidth = {cell_width};
+        static constexpr int CellPages = {cell_pages};
+        static constexpr int CellColumns = {cell_columns};
+        static constexpr int CellSize = CellPages * CellColumns;
+        static constexpr int GlyphCount = {glyph_count};
+
+        // The character of each cell, cell 0 is blank
+        static constexpr std::array<char32_t, GlyphCount> codes{{
+{codes}
+        }};
+
+        static constexpr std::array<uint8_t, GlyphCount * CellSize> cells{{
+{cells}
+        }};
+    }};
+}}
+"""
+
+GLYPH_DSC = re.compile(
+    r"/\* Unicode: U\+([0-9A-F]+) .*?\*/\s*"
+    r"\{ \.bitmap_index=(\d+), \.adv_w=(\d+), \.box_h=(\d+), \.box_w=(\d+), \.ofs_x=(-?\d+), \.ofs_y=(-?\d+) \}")
+GLYPH_PICTURE = re.compile(r"/\* Unicode: U\+([0-9A-F]+) \(.*?\), Size: \d+x\d+\n.*?Glyph.*?\n((?:\s*\*\s+[.#]+\n)+)")
+
+
+def parse_font(source):
+    """Return the bitmap bytes, glyph descriptions, glyph pictures, line height and base line"""
+    bitmap_start = source.index("glyph_bitmap[]")
+    bitmap_end = source.index("};", bitmap_start)
+    bitmap_source = re.sub(r"/\*.*?\*/", "", source[bitmap_start:bitmap_end], flags=re.S)
+    bitmap = [int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", bitmap_source)]
+
+    dsc_start = source.index("glyph_dsc[]")
+    descriptions = {}
+    for match in GLYPH_DSC.finditer(source, dsc_start):
+        code, index, adv_w, box_h, box_w, ofs_x, ofs_y = match.groups()
+        descriptions[int(code, 16)] = dict(index=int(index), adv_w=int(adv_w), box_h=int(box_h),
+                                           box_w=int(box_w), ofs_x=int(ofs_x), ofs_y=int(ofs_y))
+
+    pictures = {}
+    for match in GLYPH_PICTURE.finditer(source, bitmap_start, bitmap_end):
+        rows = [line.strip().lstrip("*").strip() for line in match.group(2).splitlines()]
+        pictures[int(match.group(1), 16)] = rows
+
+    line_height = int(re.search(r"\.line_height\s*=\s*(\d+)", source).group(1))
+    base_line = int(re.search(r"\.base_line\s*=\s*(\d+)", source).group(1))
+
+    if re.search(r"\.bpp\s*=\s*1\b", source) is None:
+        raise ValueError("only 1 bpp fonts are supported")
+
+    return bitmap, descriptions, pictures, line_height, base_line
+
+
+def render(bitmap, dsc, width, line_height, base_line):
+    """Render a glyph into a width x line_height grid of 0/1, the way LVGL places it"""
+    grid = [[0] * width for _ in range(line_height)]
+    top = line_height - base_line - dsc["box_h"] - dsc["ofs_y"]
+
+    for y in range(dsc["box_h"]):
+        for x in range(dsc["box_w"]):
+            bit = y * dsc["box_w"] + x
+            if bitmap[dsc["index"] + bit // 8] & (0x80 >> (bit % 8)):
+                grid[top + y][dsc["ofs_x"] + x] = 1
+
+    return grid
+
+
+def to_pages(grid, pages):
+    """Return the cell bytes page after page, one byte per column (row of the glyph)"""
+    cell = []
+    for page in range(pages):
+        for row in grid:
+            cell.append(sum(row[page * 8 + b] << b for b in range(8)))
+    return cell
+
+
+def generate(source, font):
+    """Return the text of the atlas header for the source of a font"""
+    bitmap, descriptions, pictures, line_height, base_line = parse_font(source)
+
+    # the font is monospaced, the cell is one advance wide rounded up to whole pages
+    cell_width = max(descriptions[ord(c)]["adv_w"] for c in GLYPHS) // 16
+    cell_pages = (cell_width + 7) // 8
+    cell_width = cell_pages * 8
+
+    codes = []
+    cells = []
+    for c in GLYPHS:
+        code = ord(c)
+        grid = render(bitmap, descriptions[code], cell_width, line_height, base_line)
+
+        picture = pictures.get(code)
+        if picture is not None:
+            expected = [[1 if p == "#" else 0 for p in row.ljust(cell_width, ".")[:cell_width]] for row in picture]
+            if expected != grid:
+                raise ValueError("glyph U+{:04X} does not match its picture in the font".format(code))
+
+        codes.append("            U'\\u{:04x}',    // {}".format(code, c if c != " " else "space"))
+
+        # one line of the header per page of the cell, a page has a column for each row of the line
+        cell = to_pages(grid, cell_pages)
+        rows = ["            " + ", ".join("0x{:02x}".format(b) for b in cell[i:i + line_height]) + ","
+                for i in range(0, len(cell), line_height)]
+        cells.append("            // {}\n".format(repr(c)) + "\n".join(rows))
+
+    return HEADER.format(font=font, cell_width=cell_width, cell_pages=cell_pages, cell_columns=line_height,
+                         glyph_count=len(GLYPHS), codes="\n".join(codes), cells="\n".join(cells))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the readout glyph atlas header from an LVGL font")
+    parser.add_argument("--check", action="store_true", help="only check that the header is up to date")
+    parser.add_argument("font", help="the LVGL font .c file")
+    parser.add_argument("atlas", help="the atlas header")
+    args = parser.parse_args()
+
+    with open(args.font, encoding="utf-8") as f:
+        source = f.read()
+
+    font = re.sub(r"\.c$", "", args.font.split("/")[-1])
+    text = generate(source, font)
+
+    if args.check:
+        with open(args.atlas, encoding="utf-8") as f:
+            if f.read() != text:
+                sys.exit("{} is out of date, regenerate it with: python3 {} {} {}".format(
+                    args.atlas, sys.argv[0], args.font, args.atlas))
+        return
+
+    with open(args.atlas, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()